@@ -0,0 +1,139 @@
+//
+// Created by dgmuller on 9/18/25.
+//
+// Times the Compositor kernels the composite Texture generators are built from, on each instruction set this CPU
+// supports: tiling a repeating texture, fading & blending an overlay, and laying out a window-sized Border. Also checks
+// that every instruction set produces the same pixels as the scalar kernels.
+//
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+#include "../include/resource/compositor.hpp"
+
+namespace {
+    constexpr sf::Vector2u OutputSize{1920, 1080};
+    constexpr sf::Vector2u TileSize{64, 48};
+    constexpr sf::Vector2u CornerSize{32, 32};
+    constexpr sf::Vector2u EdgeSize{16, 32};
+    constexpr float Opacity = 0.6f;
+    constexpr int NumRepetitions = 20;
+
+    using Pixels = std::vector<std::uint8_t>;
+
+    Pixels GenerateImage(const sf::Vector2u& size, std::mt19937& generator) {
+        Pixels pixels(static_cast<std::size_t>(size.x) * size.y * 4);
+        for(auto& channel: pixels) {
+            channel = static_cast<std::uint8_t>(generator());
+        } // for each channel
+        return pixels;
+    }
+
+    template<typename Work>
+    double Measure(Work&& work) {
+        double bestTime{0.0};
+        for(int repetition = 0; repetition < NumRepetitions; ++repetition) {
+            const auto& start{std::chrono::steady_clock::now()};
+            work();
+            const std::chrono::duration<double, std::milli> time{std::chrono::steady_clock::now() - start};
+            if(repetition == 0 || time.count() < bestTime) {
+                bestTime = time.count();
+            } // if this was the fastest run
+        } // for each repetition
+        return bestTime;
+    }
+
+    std::string_view GetName(farcical::Compositor::InstructionSet instructionSet) {
+        switch(instructionSet) {
+            case farcical::Compositor::InstructionSet::AVX2: {
+                return "AVX2";
+            }
+            case farcical::Compositor::InstructionSet::SSE2: {
+                return "SSE2";
+            }
+            default: {
+                return "scalar";
+            }
+        } // switch instructionSet
+    }
+
+    Pixels Copy(const farcical::Compositor& compositor) {
+        const farcical::Compositor::View view{compositor.GetView()};
+        return Pixels{view.pixels, view.pixels + static_cast<std::size_t>(view.size.x) * view.size.y * 4};
+    }
+}
+
+int main() {
+    using farcical::Compositor;
+    std::mt19937 generator{1234};
+    const Pixels tile{GenerateImage(TileSize, generator)};
+    const Pixels base{GenerateImage(OutputSize, generator)};
+    const Pixels overlay{GenerateImage(OutputSize, generator)};
+    std::array<Pixels, 4> corners;
+    std::array<Pixels, 4> edges;
+    std::array<Compositor::View, 4> cornerViews;
+    std::array<Compositor::View, 4> edgeViews;
+    for(int index = 0; index < 4; ++index) {
+        corners[index] = GenerateImage(CornerSize, generator);
+        edges[index] = GenerateImage(EdgeSize, generator);
+        cornerViews[index] = Compositor::View{corners[index].data(), CornerSize};
+        edgeViews[index] = Compositor::View{edges[index].data(), EdgeSize};
+    } // for each corner & edge
+    const sf::IntRect outputRect{{0, 0}, {static_cast<int>(OutputSize.x), static_cast<int>(OutputSize.y)}};
+
+    std::cout << "Composites of " << OutputSize.x << "x" << OutputSize.y << ", best of " << NumRepetitions
+              << std::endl;
+    double tileBaseline{0.0};
+    double overlayBaseline{0.0};
+    double borderBaseline{0.0};
+    std::array<Pixels, 3> scalarOutputs;
+    bool isConsistent{true};
+    const auto supported{Compositor::GetSupportedInstructionSet()};
+    for(auto instructionSet = Compositor::InstructionSet::Scalar; instructionSet <= supported;
+        instructionSet = static_cast<Compositor::InstructionSet>(static_cast<int>(instructionSet) + 1)) {
+        Compositor::SetInstructionSet(instructionSet);
+        Compositor tiled{OutputSize};
+        Compositor faded{OutputSize};
+        Compositor blended{OutputSize};
+        Compositor border{OutputSize};
+
+        const double tileTime{Measure([&]() {
+            tiled.Tile(Compositor::View{tile.data(), TileSize}, outputRect);
+        })};
+        // What CreateOverlayTexture does: fade a copy of the overlay, then blend base & overlay onto a blank canvas
+        const double overlayTime{Measure([&]() {
+            faded.Blit(Compositor::View{overlay.data(), OutputSize}, {0, 0});
+            faded.ScaleAlpha(Opacity);
+            blended = Compositor{OutputSize};
+            blended.BlendOver(Compositor::View{base.data(), OutputSize}, {0, 0});
+            blended.BlendOver(faded.GetView(), {0, 0});
+        })};
+        const double borderTime{Measure([&]() {
+            border.NineSlice(cornerViews, edgeViews, Compositor::View{tile.data(), TileSize});
+        })};
+
+        const std::array<Pixels, 3> outputs{Copy(tiled), Copy(blended), Copy(border)};
+        if(instructionSet == Compositor::InstructionSet::Scalar) {
+            scalarOutputs = outputs;
+            tileBaseline = tileTime;
+            overlayBaseline = overlayTime;
+            borderBaseline = borderTime;
+        } // if this is the scalar baseline
+        else if(outputs != scalarOutputs) {
+            isConsistent = false;
+        } // else if the kernels disagree with the scalar ones
+        std::cout << GetName(instructionSet) << ": tile " << tileTime << " ms (" << tileBaseline / tileTime
+                  << "x), overlay " << overlayTime << " ms (" << overlayBaseline / overlayTime << "x), border "
+                  << borderTime << " ms (" << borderBaseline / borderTime << "x)" << std::endl;
+    } // for each supported instruction set
+
+    if(!isConsistent) {
+        std::cerr << "Instruction sets produced different pixels!" << std::endl;
+        return 1;
+    } // if any kernel disagreed
+    return 0;
+}
@@ -0,0 +1,95 @@
+//
+// Created by dgmuller on 9/5/25.
+//
+// Compares std::string entity IDs (the old EntityID) against interned EntityIDs: the cost of registering and
+// unregistering a scene's worth of components, and the cost of the per-frame lookups the engine systems perform.
+//
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../include/engine/id.hpp"
+
+namespace {
+    constexpr int NumWidgets = 2000;
+    constexpr int NumScenes = 50;
+    constexpr int NumFrames = 600;
+    // Each system (render, input, event) looks a component up by ID about once per widget per frame
+    constexpr int LookupsPerWidget = 3;
+
+    struct BenchmarkComponent {
+        int value;
+    };
+
+    // Names shaped like the ones the UI factory derives from a scene's JSON, e.g. "mainMenuNewGameButtonLabel"
+    std::vector<std::string> GenerateNames() {
+        std::vector<std::string> names;
+        for(int index = 0; index < NumWidgets; ++index) {
+            names.push_back("displayOptionsMenuResolutionRadioButton" + std::to_string(index) + "Label");
+        } // for each widget
+        return names;
+    }
+
+    // Taking the key by value mirrors how EntityID is passed through the engine's interfaces
+    template<typename Key>
+    int Lookup(const std::unordered_map<Key, BenchmarkComponent>& components, Key id) {
+        const auto& findComponent{components.find(id)};
+        return findComponent != components.end() ? findComponent->second.value : 0;
+    }
+
+    template<typename Key>
+    void RunBenchmark(std::string_view label, const std::vector<std::string>& names) {
+        using Clock = std::chrono::steady_clock;
+        std::chrono::duration<double, std::milli> createTime{0};
+        std::chrono::duration<double, std::milli> destroyTime{0};
+        std::unordered_map<Key, BenchmarkComponent> components;
+        std::vector<Key> ids;
+
+        for(int scene = 0; scene < NumScenes; ++scene) {
+            const auto& createStart{Clock::now()};
+            ids.clear();
+            for(int index = 0; index < NumWidgets; ++index) {
+                const Key id{names[index]};
+                ids.push_back(id);
+                components.emplace(id, BenchmarkComponent{index});
+            } // for each widget
+            createTime += Clock::now() - createStart;
+
+            if(scene < NumScenes - 1) {
+                const auto& destroyStart{Clock::now()};
+                for(const auto& id: ids) {
+                    components.erase(id);
+                } // for each widget
+                destroyTime += Clock::now() - destroyStart;
+            } // if this is not the last scene
+        } // for each scene
+
+        long long checksum{0};
+        const auto& lookupStart{Clock::now()};
+        for(int frame = 0; frame < NumFrames; ++frame) {
+            for(int lookup = 0; lookup < LookupsPerWidget; ++lookup) {
+                for(const auto& id: ids) {
+                    checksum += Lookup(components, id);
+                } // for each widget
+            } // for each system
+        } // for each frame
+        const std::chrono::duration<double, std::milli> lookupTime{Clock::now() - lookupStart};
+
+        std::cout << label << "scene create " << createTime.count() / NumScenes * 1000.0 << " us, "
+                  << "scene destroy " << destroyTime.count() / (NumScenes - 1) * 1000.0 << " us, "
+                  << "lookups " << lookupTime.count() / NumFrames * 1000.0 << " us/frame "
+                  << "(checksum " << checksum << ")" << std::endl;
+    }
+}
+
+int main() {
+    const std::vector<std::string> names{GenerateNames()};
+    std::cout << NumWidgets << " widgets, " << NumScenes << " scene loads, " << NumFrames << " frames of "
+              << LookupsPerWidget << " lookups per widget" << std::endl;
+    RunBenchmark<std::string>("std::string:       ", names);
+    RunBenchmark<farcical::engine::EntityID>("engine::EntityID:  ", names);
+    std::cout << farcical::engine::EntityID::GetNumInterned() << " names interned" << std::endl;
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+// Created by dgmuller on 9/4/25.
+//
+// Compares broadcasting every mouse event to every listener (one IsPointWithinRect test per widget per event)
+// against InputSystem's coalesced, grid-indexed dispatch, on a screen filled with 5,000 buttons.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../include/engine/inputBuffer.hpp"
+#include "../include/engine/system/input.hpp"
+#include "../include/engine/system/log.hpp"
+#include "../include/geometry.hpp"
+
+namespace {
+    constexpr int NumColumns = 100;
+    constexpr int NumRows = 50;
+    constexpr int ButtonWidth = 32;
+    constexpr int ButtonHeight = 20;
+    constexpr int NumFrames = 600;
+    // Roughly what a 1000Hz mouse produces during one 60Hz frame
+    constexpr int MovesPerFrame = 16;
+
+    // Does the same work as Button::Controller: a bounds test, then a change of hover state
+    class BenchmarkListener final : public farcical::MouseInterface {
+    public:
+        explicit BenchmarkListener(sf::IntRect bounds) : MouseInterface(), bounds{bounds}, isHovered{false} {
+        }
+
+        void ReceiveMouseMovement(sf::Vector2i position) override {
+            isHovered = farcical::IsPointWithinRect(position, bounds);
+        }
+
+        void ReceiveMouseButtonPress(sf::Mouse::Button button, sf::Vector2i position) override {
+            isHovered = farcical::IsPointWithinRect(position, bounds);
+        }
+
+        void ReceiveMouseButtonRelease(sf::Mouse::Button button, sf::Vector2i position) override {
+            isHovered = farcical::IsPointWithinRect(position, bounds);
+        }
+
+        sf::IntRect bounds;
+        bool isHovered;
+    };
+
+    std::vector<sf::Event> GenerateFrame(std::mt19937& generator) {
+        std::uniform_int_distribution<int> xDistribution{0, NumColumns * ButtonWidth - 1};
+        std::uniform_int_distribution<int> yDistribution{0, NumRows * ButtonHeight - 1};
+        std::vector<sf::Event> events;
+        sf::Vector2i position{xDistribution(generator), yDistribution(generator)};
+        for(int index = 0; index < MovesPerFrame; ++index) {
+            position = sf::Vector2i{
+                std::clamp(position.x + static_cast<int>(generator() % 9) - 4, 0, NumColumns * ButtonWidth - 1),
+                std::clamp(position.y + static_cast<int>(generator() % 9) - 4, 0, NumRows * ButtonHeight - 1)
+            };
+            events.emplace_back(sf::Event::MouseMoved{position});
+        } // for each movement this frame
+        events.emplace_back(sf::Event::MouseButtonPressed{sf::Mouse::Button::Left, position});
+        events.emplace_back(sf::Event::MouseButtonReleased{sf::Mouse::Button::Left, position});
+        return events;
+    }
+}
+
+int main() {
+    std::vector<std::unique_ptr<BenchmarkListener> > listeners;
+    for(int row = 0; row < NumRows; ++row) {
+        for(int column = 0; column < NumColumns; ++column) {
+            listeners.push_back(std::make_unique<BenchmarkListener>(sf::IntRect{
+                sf::Vector2i{column * ButtonWidth, row * ButtonHeight},
+                sf::Vector2i{ButtonWidth, ButtonHeight}
+            }));
+        } // for each column
+    } // for each row
+
+    std::mt19937 generator{1234};
+    std::vector<std::vector<sf::Event> > frames;
+    for(int frame = 0; frame < NumFrames; ++frame) {
+        frames.push_back(GenerateFrame(generator));
+    } // for each frame
+
+    // Broadcast: every event goes to every listener
+    const auto& broadcastStart{std::chrono::steady_clock::now()};
+    for(const auto& frame: frames) {
+        for(const auto& event: frame) {
+            for(const auto& listener: listeners) {
+                if(const auto* mouseMoved = event.getIf<sf::Event::MouseMoved>()) {
+                    listener->ReceiveMouseMovement(mouseMoved->position);
+                } // if MouseMoved
+                else if(const auto* pressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+                    listener->ReceiveMouseButtonPress(pressed->button, pressed->position);
+                } // else if MouseButtonPressed
+                else if(const auto* released = event.getIf<sf::Event::MouseButtonReleased>()) {
+                    listener->ReceiveMouseButtonRelease(released->button, released->position);
+                } // else if MouseButtonReleased
+            } // for each listener
+        } // for each event in frame
+    } // for each frame
+    const std::chrono::duration<double, std::milli> broadcastTime{std::chrono::steady_clock::now() - broadcastStart};
+
+    // InputSystem: coalesced movements, dispatched through the spatial grid
+    farcical::engine::LogSystem logSystem{"benchmarkLog", "benchmarkLog.txt"};
+    farcical::engine::InputBuffer inputBuffer;
+    farcical::engine::InputSystem inputSystem{inputBuffer, logSystem, nullptr};
+    for(std::size_t index = 0; index < listeners.size(); ++index) {
+        const auto& createInputCmp{
+            inputSystem.CreateInputComponent(listeners[index].get(), nullptr,
+                                             farcical::engine::EntityID{"button" + std::to_string(index)},
+                                             listeners[index]->bounds)
+        };
+        if(!createInputCmp.has_value()) {
+            std::cerr << createInputCmp.error().message << std::endl;
+            return 1;
+        } // if createInputCmp == failure
+    } // for each listener
+    const auto& gridStart{std::chrono::steady_clock::now()};
+    for(const auto& frame: frames) {
+        for(const auto& event: frame) {
+            inputBuffer.Push(event);
+        } // for each event in frame
+        inputSystem.Update();
+    } // for each frame
+    const std::chrono::duration<double, std::milli> gridTime{std::chrono::steady_clock::now() - gridStart};
+
+    std::cout << listeners.size() << " buttons, " << NumFrames << " frames of " << MovesPerFrame
+              << " mouse movements plus a click" << std::endl;
+    std::cout << "broadcast:   " << broadcastTime.count() << " ms ("
+              << broadcastTime.count() / NumFrames * 1000.0 << " us/frame)" << std::endl;
+    std::cout << "InputSystem: " << gridTime.count() << " ms ("
+              << gridTime.count() / NumFrames * 1000.0 << " us/frame), "
+              << inputSystem.GetNumMovesCoalesced() << " movements coalesced" << std::endl;
+    return 0;
+}
@@ -0,0 +1,144 @@
+//
+// Created by dgmuller on 9/12/25.
+//
+// Measures how JobSystem scales from 1 to N workers on the two jobs it was built for: compositing overlay textures
+// (the per-pixel work of ResourceManager::CreateOverlayTexture, done on the CPU since workers can't touch the GPU)
+// and parsing scene documents. The main thread helps while it waits, so N workers means N + 1 busy threads.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/engine/system/job.hpp"
+#include "../include/engine/system/log.hpp"
+
+namespace {
+    constexpr unsigned int TextureSize = 512;
+    constexpr int NumTextures = 64;
+    constexpr float Opacity = 0.6f;
+    constexpr int NumScenes = 256;
+    constexpr int ElementsPerScene = 200;
+    constexpr int NumRepetitions = 3;
+
+    using Pixels = std::vector<std::uint8_t>;
+
+    Pixels GenerateTexture(std::mt19937& generator) {
+        Pixels pixels(TextureSize * TextureSize * 4);
+        for(auto& channel: pixels) {
+            channel = static_cast<std::uint8_t>(generator());
+        } // for each channel
+        return pixels;
+    }
+
+    // Fade overlay to Opacity and blend it over base, row by row in [beginRow, endRow)
+    void CompositeRows(const Pixels& base, const Pixels& overlay, Pixels& output, std::size_t beginRow,
+                       std::size_t endRow) {
+        for(std::size_t index = beginRow * TextureSize * 4; index < endRow * TextureSize * 4; index += 4) {
+            const float alpha{static_cast<float>(overlay[index + 3]) * Opacity / 255.0f};
+            for(int channel = 0; channel < 3; ++channel) {
+                output[index + channel] = static_cast<std::uint8_t>(
+                    static_cast<float>(overlay[index + channel]) * alpha
+                    + static_cast<float>(base[index + channel]) * (1.0f - alpha));
+            } // for each color channel
+            output[index + 3] = static_cast<std::uint8_t>(
+                alpha * 255.0f + static_cast<float>(base[index + 3]) * (1.0f - alpha));
+        } // for each pixel
+    }
+
+    // Shaped like a scene document: a layer full of buttons, each with textures, a label and an event
+    std::string GenerateScene(int sceneIndex, std::mt19937& generator) {
+        nlohmann::json elements = nlohmann::json::array();
+        for(int index = 0; index < ElementsPerScene; ++index) {
+            elements.push_back({
+                {"id", "scene" + std::to_string(sceneIndex) + "Button" + std::to_string(index)},
+                {"type", "button"},
+                {"position", {{"x", generator() % 1920}, {"y", generator() % 1080}}},
+                {"textures", {"buttonNormal", "buttonHighlighted", "buttonPressed"}},
+                {"label", {{"contents", "Option " + std::to_string(index)}, {"fontSize", 24}, {"font", "menuFont"}}},
+                {"event", {{"type", "CreateScene"}, {"parameters", {"scene" + std::to_string(index % 8)}}}}
+            });
+        } // for each element
+        const nlohmann::json scene{
+            {"id", "scene" + std::to_string(sceneIndex)},
+            {"type", "scene"},
+            {"music", "theme"},
+            {"layers", {{{"id", "menuLayer"}, {"elements", elements}}}}
+        };
+        return scene.dump();
+    }
+
+    template<typename Work>
+    double Measure(Work&& work) {
+        double bestTime{0.0};
+        for(int repetition = 0; repetition < NumRepetitions; ++repetition) {
+            const auto& start{std::chrono::steady_clock::now()};
+            work();
+            const std::chrono::duration<double, std::milli> time{std::chrono::steady_clock::now() - start};
+            if(repetition == 0 || time.count() < bestTime) {
+                bestTime = time.count();
+            } // if this was the fastest run
+        } // for each repetition
+        return bestTime;
+    }
+}
+
+int main() {
+    std::mt19937 generator{1234};
+    std::vector<Pixels> bases;
+    std::vector<Pixels> overlays;
+    std::vector<Pixels> outputs(NumTextures, Pixels(TextureSize * TextureSize * 4));
+    for(int index = 0; index < NumTextures; ++index) {
+        bases.push_back(GenerateTexture(generator));
+        overlays.push_back(GenerateTexture(generator));
+    } // for each texture
+    std::vector<std::string> scenes;
+    for(int index = 0; index < NumScenes; ++index) {
+        scenes.push_back(GenerateScene(index, generator));
+    } // for each scene
+    std::vector<nlohmann::json> parsedScenes(NumScenes);
+
+    farcical::engine::LogSystem logSystem{"benchmarkLog", "benchmarkLog.txt"};
+    const unsigned int maxNumWorkers{std::max(std::thread::hardware_concurrency(), 1u)};
+    std::cout << NumTextures << " composites of " << TextureSize << "x" << TextureSize << ", "
+              << NumScenes << " scenes of " << ElementsPerScene << " elements" << std::endl;
+    double compositeBaseline{0.0};
+    double parseBaseline{0.0};
+    for(unsigned int numWorkers = 1; numWorkers <= maxNumWorkers; ++numWorkers) {
+        farcical::engine::JobSystem jobSystem{logSystem, nullptr, numWorkers};
+        jobSystem.Init();
+
+        // One job per texture, each splitting its rows again, so stealing has to balance nested fan-out
+        const double compositeTime{Measure([&]() {
+            jobSystem.ParallelFor(NumTextures, 1, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t texture = begin; texture < end; ++texture) {
+                    jobSystem.ParallelFor(TextureSize, 64, [&](std::size_t beginRow, std::size_t endRow) {
+                        CompositeRows(bases[texture], overlays[texture], outputs[texture], beginRow, endRow);
+                    });
+                } // for each texture in range
+            });
+        })};
+        const double parseTime{Measure([&]() {
+            jobSystem.ParallelFor(NumScenes, 4, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t scene = begin; scene < end; ++scene) {
+                    parsedScenes[scene] = nlohmann::json::parse(scenes[scene]);
+                } // for each scene in range
+            });
+        })};
+        jobSystem.Stop();
+
+        if(numWorkers == 1) {
+            compositeBaseline = compositeTime;
+            parseBaseline = parseTime;
+        } // if this is the single-worker baseline
+        std::cout << numWorkers << " workers: composite " << compositeTime << " ms ("
+                  << compositeBaseline / compositeTime << "x), parse " << parseTime << " ms ("
+                  << parseBaseline / parseTime << "x)" << std::endl;
+    } // for each number of workers
+    return 0;
+}
@@ -0,0 +1,135 @@
+//
+// Created by dgmuller on 9/13/25.
+//
+// Compares a cold start, which parses every scene document and validates it with LoadScene (then fills the
+// SceneCache), against a warm start, which reads every Scene back from the SceneCache.
+//
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/ui/config.hpp"
+#include "../include/ui/sceneCache.hpp"
+
+namespace {
+    constexpr int NumScenes = 64;
+    constexpr int ButtonsPerMenu = 40;
+    constexpr int DecorationsPerLayer = 20;
+
+    nlohmann::json GenerateLayer(int sceneIndex, std::string_view layerName) {
+        nlohmann::json decorations = nlohmann::json::array();
+        for(int index = 0; index < DecorationsPerLayer; ++index) {
+            decorations.push_back({
+                {"id", std::string{layerName} + "Decoration" + std::to_string(index)},
+                {"relativePosition", {{"x", index * 5}, {"y", index * 3}}},
+                {"texture", "decorationTexture" + std::to_string(index % 4)}
+            });
+        } // for each decoration
+        nlohmann::json buttons = nlohmann::json::array();
+        for(int index = 0; index < ButtonsPerMenu; ++index) {
+            buttons.push_back({
+                {"id", std::string{layerName} + "Button" + std::to_string(index)},
+                {"contents", "Option " + std::to_string(index)},
+                {"onPress", {{"type", "CreateScene"}, {"args", {"scene" + std::to_string((sceneIndex + index) % NumScenes)}}}}
+            });
+        } // for each button
+        return {
+            {"id", layerName},
+            {"decorations", decorations},
+            {"title", {
+                {"id", std::string{layerName} + "Title"},
+                {"font", "titleFont"},
+                {"contents", "Scene " + std::to_string(sceneIndex)},
+                {"relativePosition", {{"x", 50}, {"y", 10}}}
+            }},
+            {"menu", {
+                {"id", std::string{layerName} + "Menu"},
+                {"type", "button"},
+                {"font", "menuFont"},
+                {"orientation", "vertical"},
+                {"relativeSpacing", 4},
+                {"relativePosition", {{"x", 50}, {"y", 40}}},
+                {"buttonTextures", {
+                    {{"state", "normal"}, {"texture", "buttonNormal"}},
+                    {{"state", "highlighted"}, {"texture", "buttonHighlighted"}},
+                    {{"state", "pressed"}, {"texture", "buttonPressed"}}
+                }},
+                {"buttons", buttons}
+            }}
+        };
+    }
+
+    nlohmann::json GenerateScene(int sceneIndex) {
+        nlohmann::json textures = nlohmann::json::array();
+        for(int index = 0; index < 16; ++index) {
+            textures.push_back({
+                {"id", "texture" + std::to_string(index)},
+                {"path", "textures/sheet.png"},
+                {"position", {{"x", index * 32}, {"y", 0}}},
+                {"inputSize", {{"width", 32}, {"height", 32}}}
+            });
+        } // for each texture
+        return {
+            {"id", "scene" + std::to_string(sceneIndex)},
+            {"music", {{"id", "theme"}, {"path", "music/theme.ogg"}, {"loop", true}}},
+            {"fonts", {
+                {{"id", "titleFont"}, {"path", "fonts/title.ttf"}, {"characterSize", 48}},
+                {{"id", "menuFont"}, {"path", "fonts/menu.ttf"}, {"characterSize", 24}}
+            }},
+            {"textures", textures},
+            {"layout", {GenerateLayer(sceneIndex, "background"), GenerateLayer(sceneIndex, "foreground")}}
+        };
+    }
+}
+
+int main() {
+    const std::filesystem::path benchmarkPath{std::filesystem::temp_directory_path() / "farcicalSceneCacheBenchmark"};
+    std::filesystem::remove_all(benchmarkPath);
+    std::filesystem::create_directories(benchmarkPath / "scenes");
+    std::vector<std::string> documentPaths;
+    for(int index = 0; index < NumScenes; ++index) {
+        documentPaths.push_back((benchmarkPath / "scenes" / ("scene" + std::to_string(index) + ".json")).string());
+        std::ofstream output{documentPaths.back()};
+        output << GenerateScene(index).dump(4);
+    } // for each scene
+    const farcical::ui::SceneCache sceneCache{(benchmarkPath / "cache").string()};
+
+    const auto& coldStart{std::chrono::steady_clock::now()};
+    for(const auto& documentPath: documentPaths) {
+        std::ifstream input{documentPath};
+        const nlohmann::json sceneJSON = nlohmann::json::parse(input);
+        const auto& loadScene{farcical::ui::LoadScene(sceneJSON)};
+        if(!loadScene.has_value()) {
+            std::cerr << loadScene.error().message << std::endl;
+            return 1;
+        } // if loadScene == failure
+        const auto& writeCache{sceneCache.Write(documentPath, loadScene.value())};
+        if(writeCache.has_value()) {
+            std::cerr << writeCache.value().message << std::endl;
+            return 1;
+        } // if writeCache == failure
+    } // for each document
+    const std::chrono::duration<double, std::milli> coldTime{std::chrono::steady_clock::now() - coldStart};
+
+    const auto& warmStart{std::chrono::steady_clock::now()};
+    for(const auto& documentPath: documentPaths) {
+        const auto& readCache{sceneCache.Read(documentPath)};
+        if(!readCache.has_value()) {
+            std::cerr << readCache.error().message << std::endl;
+            return 1;
+        } // if readCache == failure
+    } // for each document
+    const std::chrono::duration<double, std::milli> warmTime{std::chrono::steady_clock::now() - warmStart};
+
+    std::cout << NumScenes << " scenes, " << 2 * ButtonsPerMenu << " buttons & " << 2 * DecorationsPerLayer
+              << " decorations each" << std::endl;
+    std::cout << "cold (parse + LoadScene + cache): " << coldTime.count() << " ms" << std::endl;
+    std::cout << "warm (SceneCache):                " << warmTime.count() << " ms ("
+              << coldTime.count() / warmTime.count() << "x)" << std::endl;
+    std::filesystem::remove_all(benchmarkPath);
+    return 0;
+}
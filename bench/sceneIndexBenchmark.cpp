@@ -0,0 +1,145 @@
+//
+// Created by dgmuller on 9/19/25.
+//
+// Times what SceneManager::BuildPropertiesCache does at startup, on a SceneIndex of synthetic scene documents written
+// to a temporary directory: reading, parsing & validating each one in turn on the main thread, against reading &
+// parsing them all on ResourceLoader threads and validating them with JobSystem::ParallelFor.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "../include/engine/system/job.hpp"
+#include "../include/engine/system/log.hpp"
+#include "../include/resource/loader.hpp"
+#include "../include/ui/config.hpp"
+
+namespace {
+    constexpr int NumScenes = 16;
+    constexpr int NumButtons = 1000;
+    constexpr int NumDecorations = 250;
+    constexpr int NumRepetitions = 10;
+
+    using SceneResult = std::expected<farcical::ui::SceneProperties, farcical::engine::Error>;
+
+    nlohmann::json GenerateScene(int sceneIndex) {
+        nlohmann::json decorations = nlohmann::json::array();
+        for(int index = 0; index < NumDecorations; ++index) {
+            decorations.push_back({
+                {"id", "decoration" + std::to_string(index)},
+                {"relativePosition", {{"x", index % 100}, {"y", index / 100}}},
+                {"texture", "decorationTexture" + std::to_string(index % 8)}
+            });
+        } // for each decoration
+        nlohmann::json buttons = nlohmann::json::array();
+        for(int index = 0; index < NumButtons; ++index) {
+            buttons.push_back({
+                {"id", "button" + std::to_string(index)},
+                {"contents", "Option " + std::to_string(index)},
+                {"onPress", {{"type", "CreateScene"}, {"args", {"scene" + std::to_string(index % NumScenes)}}}}
+            });
+        } // for each button
+        return {
+            {"id", "scene" + std::to_string(sceneIndex)},
+            {"fonts", {{{"id", "menuFont"}, {"path", "fonts/menu.ttf"}, {"characterSize", 24}}}},
+            {"layout", {
+                {{"id", "background"}, {"decorations", decorations}},
+                {{"id", "foreground"}, {"menu", {
+                    {"id", "menu"},
+                    {"type", "button"},
+                    {"font", "menuFont"},
+                    {"orientation", "vertical"},
+                    {"relativeSpacing", 1},
+                    {"relativePosition", {{"x", 50}, {"y", 10}}},
+                    {"buttonTextures", {{{"state", "normal"}, {"texture", "buttonNormal"}}}},
+                    {"buttons", buttons}
+                }}}
+            }}
+        };
+    }
+
+    // What ResourceManager does with a JSONDocument
+    nlohmann::json ReadDocument(const std::string& path) {
+        std::ifstream input{path};
+        const std::string contents{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+        return nlohmann::json::parse(contents);
+    }
+
+    template<typename Work>
+    double Measure(Work&& work) {
+        double bestTime{0.0};
+        for(int repetition = 0; repetition < NumRepetitions; ++repetition) {
+            const auto& start{std::chrono::steady_clock::now()};
+            work();
+            const std::chrono::duration<double, std::milli> time{std::chrono::steady_clock::now() - start};
+            if(repetition == 0 || time.count() < bestTime) {
+                bestTime = time.count();
+            } // if this was the fastest run
+        } // for each repetition
+        return bestTime;
+    }
+}
+
+int main() {
+    const std::filesystem::path directory{std::filesystem::temp_directory_path() / "farcicalSceneIndexBenchmark"};
+    std::filesystem::create_directories(directory);
+    std::vector<std::string> documentPaths;
+    std::uintmax_t totalSize{0};
+    for(int index = 0; index < NumScenes; ++index) {
+        const std::filesystem::path documentPath{directory / ("scene" + std::to_string(index) + ".json")};
+        std::ofstream{documentPath} << GenerateScene(index).dump(4);
+        documentPaths.push_back(documentPath.string());
+        totalSize += std::filesystem::file_size(documentPath);
+    } // for each scene
+    std::cout << NumScenes << " scenes of " << NumButtons << " buttons & " << NumDecorations << " decorations, "
+              << totalSize / 1024 << " KiB of JSON, best of " << NumRepetitions << std::endl;
+
+    std::vector<SceneResult> results(NumScenes);
+    bool isValid{true};
+    // One document after another, the way BuildPropertiesCache worked before it went parallel
+    const double serialTime{Measure([&]() {
+        for(int index = 0; index < NumScenes; ++index) {
+            results[index] = farcical::ui::LoadScene(ReadDocument(documentPaths[index]));
+        } // for each scene
+    })};
+    isValid = isValid && std::ranges::all_of(results, [](const SceneResult& result) { return result.has_value(); });
+
+    farcical::engine::LogSystem logSystem{"benchmarkLog", "benchmarkLog.txt"};
+    farcical::engine::JobSystem jobSystem{logSystem, nullptr};
+    jobSystem.Init();
+    farcical::ResourceLoader resourceLoader;
+    std::vector<nlohmann::json> documents(NumScenes);
+    const double parallelTime{Measure([&]() {
+        for(int index = 0; index < NumScenes; ++index) {
+            resourceLoader.Submit([&, index]() {
+                documents[index] = ReadDocument(documentPaths[index]);
+            });
+        } // for each scene
+        resourceLoader.WaitIdle();
+        jobSystem.ParallelFor(NumScenes, 1, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t index = begin; index < end; ++index) {
+                results[index] = farcical::ui::LoadScene(documents[index]);
+            } // for each scene in range
+        });
+    })};
+    jobSystem.Stop();
+    isValid = isValid && std::ranges::all_of(results, [](const SceneResult& result) { return result.has_value(); });
+
+    std::cout << "serial: " << serialTime << " ms" << std::endl;
+    std::cout << "parallel (" << resourceLoader.GetNumThreads() << " loaders, " << jobSystem.GetNumWorkers()
+              << " workers): " << parallelTime << " ms (" << serialTime / parallelTime << "x)" << std::endl;
+
+    std::filesystem::remove_all(directory);
+    if(!isValid) {
+        std::cerr << "A scene document failed to load!" << std::endl;
+        return 1;
+    } // if any scene failed
+    return 0;
+}
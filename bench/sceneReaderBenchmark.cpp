@@ -0,0 +1,141 @@
+//
+// Created by dgmuller on 9/14/25.
+//
+// Compares building a DOM with nlohmann::json::parse and walking it with LoadScene against streaming the same document
+// with ReadScene, on one synthetic 10,000-widget scene. Peak memory is the most heap either one holds at once, on top
+// of the document text they both start from.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <nlohmann/json.hpp>
+#include "../include/ui/sceneReader.hpp"
+
+namespace {
+    constexpr int NumButtons = 8000;
+    constexpr int NumDecorations = 2000;
+    constexpr int NumRepetitions = 5;
+
+    std::atomic<std::size_t> allocatedBytes{0};
+    std::atomic<std::size_t> peakBytes{0};
+
+    // Every allocation carries its size in front of it, so operator delete knows how much to give back
+    constexpr std::size_t SizeHeader = alignof(std::max_align_t);
+
+    nlohmann::json GenerateScene() {
+        nlohmann::json decorations = nlohmann::json::array();
+        for(int index = 0; index < NumDecorations; ++index) {
+            decorations.push_back({
+                {"id", "decoration" + std::to_string(index)},
+                {"relativePosition", {{"x", index % 100}, {"y", index / 100}}},
+                {"texture", "decorationTexture" + std::to_string(index % 8)}
+            });
+        } // for each decoration
+        nlohmann::json buttons = nlohmann::json::array();
+        for(int index = 0; index < NumButtons; ++index) {
+            buttons.push_back({
+                {"id", "button" + std::to_string(index)},
+                {"contents", "Option " + std::to_string(index)},
+                {"onPress", {{"type", "CreateScene"}, {"args", {"scene" + std::to_string(index % 16)}}}}
+            });
+        } // for each button
+        return {
+            {"id", "hugeScene"},
+            {"fonts", {{{"id", "menuFont"}, {"path", "fonts/menu.ttf"}, {"characterSize", 24}}}},
+            {"layout", {
+                {{"id", "background"}, {"decorations", decorations}},
+                {{"id", "foreground"}, {"menu", {
+                    {"id", "hugeMenu"},
+                    {"type", "button"},
+                    {"font", "menuFont"},
+                    {"orientation", "vertical"},
+                    {"relativeSpacing", 1},
+                    {"relativePosition", {{"x", 50}, {"y", 10}}},
+                    {"buttonTextures", {{{"state", "normal"}, {"texture", "buttonNormal"}}}},
+                    {"buttons", buttons}
+                }}}
+            }}
+        };
+    }
+
+    struct Measurement {
+        double time;
+        std::size_t peakBytes;
+    };
+
+    template<typename Work>
+    Measurement Measure(Work&& work) {
+        Measurement best{0.0, 0};
+        for(int repetition = 0; repetition < NumRepetitions; ++repetition) {
+            const std::size_t baseline{allocatedBytes.load()};
+            peakBytes = baseline;
+            const auto& start{std::chrono::steady_clock::now()};
+            work();
+            const std::chrono::duration<double, std::milli> time{std::chrono::steady_clock::now() - start};
+            if(repetition == 0 || time.count() < best.time) {
+                best.time = time.count();
+            } // if this was the fastest run
+            best.peakBytes = std::max(best.peakBytes, peakBytes.load() - baseline);
+        } // for each repetition
+        return best;
+    }
+}
+
+void* operator new(std::size_t size) {
+    auto* block{static_cast<char*>(std::malloc(size + SizeHeader))};
+    if(!block) {
+        throw std::bad_alloc{};
+    } // if !block
+    *reinterpret_cast<std::size_t*>(block) = size;
+    const std::size_t allocated{allocatedBytes.fetch_add(size) + size};
+    std::size_t peak{peakBytes.load()};
+    while(allocated > peak && !peakBytes.compare_exchange_weak(peak, allocated)) {
+    } // while peak is out of date
+    return block + SizeHeader;
+}
+
+void operator delete(void* pointer) noexcept {
+    if(!pointer) {
+        return;
+    } // if !pointer
+    char* block{static_cast<char*>(pointer) - SizeHeader};
+    allocatedBytes.fetch_sub(*reinterpret_cast<std::size_t*>(block));
+    std::free(block);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
+
+int main() {
+    const std::string document{GenerateScene().dump(4)};
+    std::cout << "1 scene, " << NumButtons << " buttons & " << NumDecorations << " decorations, "
+              << document.size() / 1024 << " KiB of JSON" << std::endl;
+
+    const Measurement dom{Measure([&]() {
+        const nlohmann::json sceneJSON = nlohmann::json::parse(document);
+        const auto& loadScene{farcical::ui::LoadScene(sceneJSON)};
+        if(!loadScene.has_value()) {
+            std::cerr << loadScene.error().message << std::endl;
+            std::exit(1);
+        } // if loadScene == failure
+    })};
+    const Measurement stream{Measure([&]() {
+        const auto& readScene{farcical::ui::ReadScene(document)};
+        if(!readScene.has_value()) {
+            std::cerr << readScene.error().message << std::endl;
+            std::exit(1);
+        } // if readScene == failure
+    })};
+
+    std::cout << "DOM (parse + LoadScene): " << dom.time << " ms, peak " << dom.peakBytes / 1024 << " KiB" << std::endl;
+    std::cout << "streaming (ReadScene):   " << stream.time << " ms, peak " << stream.peakBytes / 1024 << " KiB ("
+              << dom.time / stream.time << "x faster, " << static_cast<double>(dom.peakBytes) / stream.peakBytes
+              << "x less memory)" << std::endl;
+    return 0;
+}
@@ -6,8 +6,12 @@
 #define COMPONENT_HPP
 
 #include "../id.hpp"
+#include "../slotMap.hpp"
 
 namespace farcical::engine {
+    // Components are owned by their System's SlotMap; everything else refers to them by handle
+    using ComponentHandle = Handle;
+
     struct Component {
         enum class Type {
             Render = 0,
@@ -25,6 +29,15 @@ namespace farcical::engine {
         }
 
         virtual ~Component() = default;
+
+        // Components are stored by value, and moved whenever their SlotMap swap-removes or grows
+        Component(const Component&) = default;
+
+        Component(Component&&) = default;
+
+        Component& operator=(const Component&) = default;
+
+        Component& operator=(Component&&) = default;
     };
 }
 
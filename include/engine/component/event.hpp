@@ -19,8 +19,6 @@ namespace farcical::engine {
                                                      handler{nullptr} {
         }
 
-        ~EventComponent() override = default;
-
         [[nodiscard]] bool CanHandleEventType(Event::Type type) const {
             bool canHandle{false};
             for(const auto& handled: handledTypes) {
@@ -5,6 +5,7 @@
 #ifndef INPUT_COMPONENT_HPP
 #define INPUT_COMPONENT_HPP
 
+#include <SFML/Graphics/Rect.hpp>
 #include "component.hpp"
 #include "../keyboard.hpp"
 #include "../mouse.hpp"
@@ -13,15 +14,16 @@ namespace farcical::engine {
     struct InputComponent final : public Component {
         KeyboardInterface* keyboard;
         MouseInterface* mouse;
+        // Screen area in which this component receives mouse events; an empty rect receives all of them
+        sf::IntRect bounds;
 
         InputComponent() = delete;
 
         explicit InputComponent(EntityID parentID) : Component(Type::Input, parentID),
                                                      keyboard{nullptr},
-                                                     mouse{nullptr} {
+                                                     mouse{nullptr},
+                                                     bounds{} {
         }
-
-        ~InputComponent() override = default;
     };
 }
 #endif //INPUT_COMPONENT_HPP
\ No newline at end of file
@@ -5,31 +5,140 @@
 #ifndef RENDER_COMPONENT_HPP
 #define RENDER_COMPONENT_HPP
 
+#include <array>
+#include <optional>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
 #include "component.hpp"
 #include "../../resource/config.hpp"
+#include "../../ui/layout.hpp"
 
 namespace farcical::engine {
+    // A Border drawn from its slices at any size: corners as they are, edges & center repeated to fill the space
+    // between them. Each slice is its own small Texture, since a Texture repeats as a whole.
+    struct NineSlice {
+        // Rectangle::Corner order
+        std::array<sf::Texture*, static_cast<int>(Rectangle::Corner::NumCorners)> corners;
+        // Rectangle::Edge order
+        std::array<sf::Texture*, static_cast<int>(Rectangle::Edge::NumEdges)> edges;
+        sf::Texture* center;
+        // Before scaling, i.e. in the slices' own pixels
+        sf::Vector2f size;
+    };
+
     struct RenderComponent final : public Component {
+        // The RenderContext & RenderLayer this component is drawn in
+        EntityID sceneID;
+        ui::Layout::Layer::ID layerID;
+        // Creation order, which is draw order within a layer (storage order changes as components are destroyed)
+        std::uint64_t sequence;
         sf::Texture* texture;
+        std::optional<NineSlice> nineSlice;
         sf::Font* font;
         FontProperties fontProperties;
         std::string contents;
         sf::Vector2f position;
         sf::Vector2f scale;
+        // Set whenever this component changes in a way that invalidates its RenderLayer's batches
+        bool isDirty;
+        // Set whenever the retained sf::Text no longer matches the properties above
+        bool isTextDirty;
 
         RenderComponent() = delete;
 
-        explicit RenderComponent(EntityID parentID) : Component(Type::Render, parentID),
-                                                      texture{nullptr},
-                                                      font{nullptr},
-                                                      contents{""},
-                                                      position{0.0f, 0.0f},
-                                                      scale{1.0f, 1.0f} {
+        explicit RenderComponent(EntityID parentID,
+                                 EntityID sceneID,
+                                 ui::Layout::Layer::ID layerID,
+                                 std::uint64_t sequence) : Component(Type::Render, parentID),
+                                                           sceneID{sceneID},
+                                                           layerID{layerID},
+                                                           sequence{sequence},
+                                                           texture{nullptr},
+                                                           font{nullptr},
+                                                           contents{""},
+                                                           position{0.0f, 0.0f},
+                                                           scale{1.0f, 1.0f},
+                                                           isDirty{true},
+                                                           isTextDirty{true} {
+        }
+
+        void SetTexture(sf::Texture* texture) {
+            if(this->texture != texture) {
+                this->texture = texture;
+                isDirty = true;
+            } // if texture changed
+        }
+
+        void SetNineSlice(const NineSlice& nineSlice) {
+            this->nineSlice = nineSlice;
+            isDirty = true;
+        }
+
+        void SetFont(sf::Font* font) {
+            if(this->font != font) {
+                this->font = font;
+                isDirty = true;
+                isTextDirty = true;
+            } // if font changed
+        }
+
+        void SetFontProperties(const FontProperties& fontProperties) {
+            this->fontProperties = fontProperties;
+            isDirty = true;
+            isTextDirty = true;
+        }
+
+        void SetContents(std::string_view contents) {
+            if(this->contents != contents) {
+                this->contents = contents;
+                isDirty = true;
+                isTextDirty = true;
+            } // if contents changed
+        }
+
+        void SetPosition(sf::Vector2f position) {
+            if(this->position != position) {
+                this->position = position;
+                isDirty = true;
+                isTextDirty = true;
+            } // if position changed
+        }
+
+        void SetScale(sf::Vector2f scale) {
+            if(this->scale != scale) {
+                this->scale = scale;
+                isDirty = true;
+                isTextDirty = true;
+            } // if scale changed
+        }
+
+        // Returns the retained sf::Text for a text component (nullptr if there is no font),
+        // bringing it up to date first if any of its properties changed since the last call
+        sf::Text* GetText() {
+            if(!font) {
+                return nullptr;
+            } // if no font
+            if(!text.has_value()) {
+                text.emplace(*font, contents, fontProperties.characterSize);
+                isTextDirty = true;
+            } // if text has not been created yet
+            if(isTextDirty) {
+                text->setFont(*font);
+                text->setString(contents);
+                text->setCharacterSize(fontProperties.characterSize);
+                text->setScale(scale);
+                text->setPosition(position);
+                text->setFillColor(fontProperties.color);
+                text->setOutlineColor(fontProperties.outlineColor);
+                text->setOutlineThickness(fontProperties.outlineThickness);
+                isTextDirty = false;
+            } // if text needs updating
+            return &text.value();
         }
 
-        ~RenderComponent() override = default;
+    private:
+        std::optional<sf::Text> text;
     };
 }
 
@@ -5,6 +5,7 @@
 #ifndef ENGINE_CONFIG_HPP
 #define ENGINE_CONFIG_HPP
 
+#include <cstdint>
 #include <expected>
 #include <nlohmann/json.hpp>
 #include "error.hpp"
@@ -15,6 +16,52 @@ namespace farcical::engine {
         WindowProperties windowProperties;
         std::string scenePath;
         std::string logPath;
+        // Number of fixed-length game simulation steps per second, independent of the frame rate
+        int tickRate;
+        // Most simulation steps run in a single frame; time beyond that is dropped so a slow machine cannot fall
+        // further and further behind
+        int maxTicksPerFrame;
+        // log.txt is rotated once it would grow past maxLogSize bytes (0 disables rotation); maxLogFiles counts the
+        // current file plus the rotated ones that are kept
+        std::uintmax_t maxLogSize;
+        std::size_t maxLogFiles;
+        // Size in bytes of the crash-safe ring of recent log records kept next to log.txt; 0 disables it
+        std::uint32_t flightRecorderSize;
+        // Parse each scene document the first time its Scene is created, rather than all of them at startup
+        bool loadScenesOnDemand;
+        // With loadScenesOnDemand, the most SceneProperties kept parsed at once (0 keeps all of them); the least
+        // recently used are dropped first
+        std::size_t maxCachedScenes;
+        // With loadScenesOnDemand, start reading the documents of the Scenes the current one's buttons can create
+        bool preloadLinkedScenes;
+        // Directory for binary copies of parsed scene documents, so warm starts skip JSON parsing; empty disables it
+        std::string sceneCachePath;
+        // AssetPack to mount at startup, so assets are read from one mapped file instead of one file each; empty
+        // loads everything from loose files
+        std::string assetPackPath;
+        // A loose file that exists on disk is loaded instead of its packed copy, so assets can be edited without
+        // rebuilding the pack. Every packed lookup checks the disk first, so it's off by default in release builds.
+        bool looseAssetsOverridePack;
+        // Directory written by farcical_cook; composite textures found there are loaded instead of being drawn every
+        // time a Scene is created. Empty disables it. Point sceneCachePath at its scenes/ to use the cooked
+        // SceneProperties as well.
+        std::string cookedAssetPath;
+        // Directory for the pixels of composite textures (spliced, repeating, overlay & border), so they're only drawn
+        // again when an input file or the scene document changes; empty disables it
+        std::string compositeCachePath;
+        // compositeCachePath is kept under maxCompositeCacheSize bytes by deleting its least recently used textures
+        std::uintmax_t maxCompositeCacheSize;
+
+        static constexpr int DefaultTickRate = 60;
+        static constexpr int DefaultMaxTicksPerFrame = 5;
+        static constexpr std::size_t DefaultMaxCachedScenes = 16;
+        static constexpr std::string_view DefaultSceneCachePath = "cache/scenes";
+        static constexpr std::string_view DefaultCompositeCachePath = "cache/composites";
+#ifdef NDEBUG
+        static constexpr bool DefaultLooseAssetsOverridePack = false;
+#else
+        static constexpr bool DefaultLooseAssetsOverridePack = true;
+#endif
     };
 
     std::expected<Config, Error> LoadConfig(const nlohmann::json& json,
@@ -5,15 +5,22 @@
 #ifndef ENGINE_HPP
 #define ENGINE_HPP
 
+#include <cstdint>
 #include <optional>
 #include <memory>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Keyboard.hpp>
 
 #include "config.hpp"
 #include "error.hpp"
 #include "errorHandler.hpp"
+#include "inputBuffer.hpp"
+#include "profiler.hpp"
 #include "system/event.hpp"
 #include "system/input.hpp"
+#include "system/job.hpp"
 #include "system/log.hpp"
 #include "system/music.hpp"
 #include "system/render.hpp"
@@ -75,12 +82,20 @@ namespace farcical {
 
             [[nodiscard]] InputSystem& GetInputSystem() const;
 
+            [[nodiscard]] JobSystem& GetJobSystem() const;
+
             [[nodiscard]] LogSystem& GetLogSystem() const;
 
             [[nodiscard]] MusicSystem& GetMusicSystem() const;
 
             [[nodiscard]] RenderSystem& GetRenderSystem() const;
 
+            // Total time spent blocked waiting for input while there was nothing to update
+            [[nodiscard]] sf::Time GetIdleTime() const;
+
+            // Number of frames that were not drawn because nothing on screen had changed
+            [[nodiscard]] std::uint64_t GetNumFramesSaved() const;
+
         private:
             Status status;
 
@@ -91,6 +106,9 @@ namespace farcical {
 
             std::unique_ptr<sf::RenderWindow> window;
 
+            // Every window event is drained into this buffer exactly once per frame, then consumed by InputSystem
+            InputBuffer inputBuffer;
+
             ResourceManager resourceManager;
 
             std::unique_ptr<ui::SceneManager> sceneManager;
@@ -99,6 +117,8 @@ namespace farcical {
 
             std::unique_ptr<InputSystem> inputSystem;
 
+            std::unique_ptr<JobSystem> jobSystem;
+
             std::unique_ptr<LogSystem> logSystem;
 
             std::unique_ptr<MusicSystem> musicSystem;
@@ -107,8 +127,36 @@ namespace farcical {
 
             game::Game* game;
 
+            sf::Time idleTime;
+            std::uint64_t numFramesSaved;
+
+            // Real time not yet consumed by fixed-length simulation ticks
+            sf::Clock frameClock;
+            sf::Time tickAccumulator;
+
             static constexpr std::string_view configDocumentID = "engineConfig";
             static constexpr std::string_view engineLogID = "farcicalLog";
+            // Upper bound on how long an idle engine sleeps before re-checking the game's status
+            static constexpr int idleTimeoutMS = 250;
+            // Longest each frame spends turning asynchronously loaded resources into textures, fonts, etc.
+            static constexpr int resourceUploadBudgetMS = 4;
+            static constexpr std::string_view profilerTraceFileName = "trace.json";
+            // Writes the profiler's history on demand (FARCICAL_ENABLE_PROFILER builds only)
+            static constexpr sf::Keyboard::Key profilerTraceKey = sf::Keyboard::Key::F12;
+
+            // Nothing needs drawing, no Events are queued and no music changes are waiting to be applied
+            [[nodiscard]] bool IsIdle() const;
+
+            [[nodiscard]] sf::Time GetTickLength() const;
+
+            // Run Game::Update once per whole tick of accumulated time; returns false if the game failed
+            bool RunSimulationTicks();
+
+            // Drain the window's event queue into inputBuffer; returns false if the window was closed
+            bool PumpEvents();
+
+            // Returns false if the event closed the window
+            bool HandleWindowEvent(const sf::Event& event);
 
             std::optional<Error> CreateLogSystem();
 
@@ -117,6 +165,9 @@ namespace farcical {
             std::optional<Error> CreateSystems();
 
             std::optional<Error> InitSystems();
+
+            // Write the Profiler's frame history next to the log, as Chrome trace_event JSON
+            void WriteProfilerTrace();
         };
     }
 }
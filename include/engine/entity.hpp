@@ -9,14 +9,14 @@
 #include "component/component.hpp"
 
 namespace farcical::engine {
-    using ComponentList = std::array<Component*, static_cast<int>(Component::Type::NumComponentTypes)>;
+    using ComponentList = std::array<ComponentHandle, static_cast<int>(Component::Type::NumComponentTypes)>;
 
     class Entity {
     public:
         Entity() = delete;
 
         explicit Entity(EntityID id) : id{id},
-                                       components{nullptr} {
+                                       components{} {
         }
 
         virtual ~Entity() = default;
@@ -24,18 +24,20 @@ namespace farcical::engine {
         [[nodiscard]] EntityID GetID() const { return id; }
 
         [[nodiscard]] const ComponentList& GetComponents() const { return components; }
-        [[nodiscard]] Component* GetComponent(Component::Type type) const { return components[static_cast<int>(type)]; }
+        [[nodiscard]] ComponentHandle GetComponent(Component::Type type) const {
+            return components[static_cast<int>(type)];
+        }
 
         [[nodiscard]] bool HasComponent(Component::Type type) const {
-            return components[static_cast<int>(type)] != nullptr;
+            return components[static_cast<int>(type)].IsValid();
         }
 
-        void AddComponent(Component* component) {
-            components[static_cast<int>(component->type)] = component;
+        void AddComponent(Component::Type type, ComponentHandle handle) {
+            components[static_cast<int>(type)] = handle;
         }
 
         void RemoveComponent(Component::Type type) {
-            components[static_cast<int>(type)] = nullptr;
+            components[static_cast<int>(type)] = ComponentHandle{};
         }
 
     protected:
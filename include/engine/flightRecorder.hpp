@@ -0,0 +1,81 @@
+//
+// Created by dgmuller on 9/10/25.
+//
+
+#ifndef FLIGHT_RECORDER_HPP
+#define FLIGHT_RECORDER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <expected>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "error.hpp"
+#include "mappedFile.hpp"
+
+namespace farcical::engine {
+    // Keeps the most recent log records in a fixed-size, memory-mapped ring file. Each record is copied straight into
+    // the mapping, so whatever was written before a crash is already in the kernel's hands and survives the process.
+    // Decode the file with ReadRing (or the logdump tool).
+    //
+    // File layout: a Header, then capacity bytes of ring. Records are lines ending in '\n'; byte N of the stream
+    // ever written lives at ring[N % capacity], and writePosition is the length of that stream.
+    //
+    // Writers don't share a lock: each reserves its bytes with a fetch_add on reservePosition and copies them in
+    // concurrently, then publishes in reservation order, so writePosition never covers a record still being copied.
+    class FlightRecorder {
+    public:
+        static constexpr char Magic[8] = {'F', 'A', 'R', 'C', 'F', 'L', 'T', 'R'};
+        static constexpr std::uint32_t Version = 1;
+        static constexpr std::size_t HeaderSize = 64;
+
+        struct Header {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t capacity;
+            // Every byte before this has been copied in, so a crash mid-write can only garble the oldest records
+            std::uint64_t writePosition;
+        };
+
+        static_assert(sizeof(Header) <= HeaderSize);
+
+        FlightRecorder() = default;
+
+        ~FlightRecorder() = default;
+
+        FlightRecorder(const FlightRecorder&) = delete;
+
+        FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+        // Map (creating if necessary) a ring of capacity bytes at path. An existing ring of the same capacity is
+        // appended to, so the records from before a crash are still there after a restart until they're overwritten.
+        std::optional<Error> Open(std::string_view path, std::uint32_t capacity);
+
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const;
+
+        // Safe to call from any thread, Open & Close included. Records longer than the ring are truncated.
+        void Write(std::string_view record);
+
+        // Every complete record still in the ring at path, oldest first, as newline-separated text
+        static std::expected<std::string, Error> ReadRing(std::string_view path);
+
+    private:
+        Header* GetHeader();
+
+        // Only serializes Open & Close; Write never takes it
+        std::mutex mutex;
+        MappedFile file;
+        std::atomic<std::byte*> ring{nullptr};
+        std::uint32_t capacity{0};
+        // The next byte of the stream a Write may claim; runs ahead of writePosition while records are being copied
+        std::atomic<std::uint64_t> reservePosition{0};
+        // Writes between claiming the ring and publishing their record, so Close can wait for them before unmapping
+        std::atomic<std::uint32_t> numWriters{0};
+    };
+}
+
+#endif //FLIGHT_RECORDER_HPP
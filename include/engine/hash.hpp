@@ -0,0 +1,23 @@
+//
+// Created by dgmuller on 9/15/25.
+//
+
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace farcical::engine {
+    // 64-bit FNV-1a: not cryptographic, just cheap & stable across runs and platforms, so it can be written to disk
+    constexpr std::uint64_t HashBytes(std::string_view bytes) {
+        std::uint64_t hash{0xcbf29ce484222325};
+        for(const char byte: bytes) {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 0x100000001b3;
+        } // for each byte
+        return hash;
+    }
+}
+
+#endif //HASH_HPP
@@ -5,10 +5,81 @@
 #ifndef ID_HPP
 #define ID_HPP
 
+#include <compare>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace farcical::engine {
-    using EntityID = std::string;
+    // A compact handle for an entity name. Names are interned into a process-wide table, and never removed, the first
+    // time an EntityID is constructed from them, so comparing and hashing an EntityID are integer operations and
+    // passing one by value never allocates. The name itself is only looked up for logging & debugging. Constructing
+    // one is meant for building a Scene; anything looking up a name it was handed should use Find instead.
+    class EntityID {
+    public:
+        using Value = std::uint32_t;
+
+        static constexpr Value Empty = 0;
+
+        constexpr EntityID() : value{Empty} {
+        }
+
+        explicit EntityID(std::string_view name) : value{Intern(name)} {
+        }
+
+        explicit EntityID(const std::string& name) : value{Intern(name)} {
+        }
+
+        explicit EntityID(const char* name) : value{Intern(name)} {
+        }
+
+        [[nodiscard]] constexpr Value GetValue() const { return value; }
+        [[nodiscard]] const std::string& GetName() const;
+        [[nodiscard]] constexpr bool empty() const { return value == Empty; }
+
+        constexpr bool operator==(const EntityID& rhs) const = default;
+        constexpr auto operator<=>(const EntityID& rhs) const = default;
+
+        // The EntityID already interned for name, or nullopt if nothing has that name; never adds it to the table
+        [[nodiscard]] static std::optional<EntityID> Find(std::string_view name);
+
+        // Returns the number of distinct names interned so far, including the empty name.
+        static std::size_t GetNumInterned();
+
+    private:
+        constexpr explicit EntityID(Value value) : value{value} {
+        }
+
+        static Value Intern(std::string_view name);
+
+        Value value;
+    };
+
+    // Concatenation yields a plain string, e.g. when deriving a child's name from its parent's
+    std::string operator+(const EntityID& lhs, std::string_view rhs);
+    std::string operator+(std::string_view lhs, const EntityID& rhs);
+    std::string operator+(const EntityID& lhs, const char* rhs);
+    std::string operator+(const char* lhs, const EntityID& rhs);
+    std::string operator+(const EntityID& lhs, const std::string& rhs);
+    std::string operator+(const std::string& lhs, const EntityID& rhs);
 }
 
+template<>
+struct std::hash<farcical::engine::EntityID> {
+    std::size_t operator()(const farcical::engine::EntityID& id) const noexcept {
+        return static_cast<std::size_t>(id.GetValue());
+    }
+};
+
+// Formats as the interned name, so an EntityID can be passed straight to the LogInterface functions
+template<>
+struct std::formatter<farcical::engine::EntityID> : std::formatter<std::string_view> {
+    auto format(const farcical::engine::EntityID& id, std::format_context& context) const {
+        return std::formatter<std::string_view>::format(id.GetName(), context);
+    }
+};
+
 #endif //ID_HPP
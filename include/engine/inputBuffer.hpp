@@ -0,0 +1,61 @@
+//
+// Created by dgmuller on 9/2/25.
+//
+
+#ifndef INPUT_BUFFER_HPP
+#define INPUT_BUFFER_HPP
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Event.hpp>
+
+namespace farcical::engine {
+    struct InputRecord {
+        sf::Event event;
+        // Time at which the event was drained from the window's event queue
+        sf::Time timestamp;
+    };
+
+    // Fixed-capacity ring buffer of window events, filled once per frame by the Engine and consumed by InputSystem.
+    // All storage is allocated up front, so pushing and popping never allocate.
+    class InputBuffer {
+    public:
+        static constexpr std::size_t Capacity = 256;
+
+        InputBuffer();
+
+        InputBuffer(const InputBuffer&) = delete;
+
+        InputBuffer(InputBuffer&) = delete;
+
+        ~InputBuffer() = default;
+
+        // Timestamp the event and append it; returns false (leaving the buffer unchanged) if the buffer is full
+        bool Push(const sf::Event& event);
+
+        // Remove and return the oldest record, if any
+        std::optional<InputRecord> Pop();
+
+        void Clear();
+
+        [[nodiscard]] bool IsEmpty() const;
+
+        [[nodiscard]] bool IsFull() const;
+
+        [[nodiscard]] std::size_t GetSize() const;
+
+        // Current time on the clock used to timestamp records
+        [[nodiscard]] sf::Time GetTime() const;
+
+    private:
+        std::array<std::optional<InputRecord>, Capacity> records;
+        std::size_t head;
+        std::size_t size;
+        sf::Clock clock;
+    };
+}
+
+#endif //INPUT_BUFFER_HPP
@@ -5,24 +5,110 @@
 #ifndef LOG_INTERFACE_HPP
 #define LOG_INTERFACE_HPP
 
+#include <cstdint>
+#include <format>
+#include <iterator>
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace farcical::engine {
     class LogSystem;
 
+    enum class LogLevel : std::uint8_t {
+        Trace,
+        Debug,
+        Info,
+        Warning,
+        Error
+    };
+
+    // Records below this level are never formatted or submitted. Their arguments are still evaluated wherever
+    // LogTrace & LogDebug are called directly; FARCICAL_LOG_TRACE & FARCICAL_LOG_DEBUG remove the whole call instead.
+#ifdef NDEBUG
+    inline constexpr LogLevel MinLogLevel{LogLevel::Info};
+#else
+    inline constexpr LogLevel MinLogLevel{LogLevel::Trace};
+#endif
+
+    std::string_view GetLogLevelName(LogLevel level);
+
+    // Writes leveled records to the LogSystem, tagged with this object's source name. Messages take std::format
+    // strings and are only formatted if their level is enabled. Each record is one line:
+    //   2025-09-09 14:02:11.042 INFO  [T0] [RenderSystem] RenderSystem initialized.
+    // Timestamps are UTC; T<n> is the emitting thread's GetThreadIndex().
     class LogInterface {
     public:
         LogInterface() = delete;
 
-        explicit LogInterface(LogSystem& logSystem);
+        LogInterface(LogSystem& logSystem, std::string_view source);
 
         virtual ~LogInterface() = default;
 
-        void WriteToLog(std::string_view message) const;
+        template<LogLevel level, typename... Args>
+        void Log(std::format_string<Args...> format, Args&&... args) const {
+            if constexpr(level >= MinLogLevel) {
+                if(!IsLogLevelEnabled(level)) {
+                    return;
+                } // if level is disabled at runtime
+                std::string record{BeginLogRecord(level)};
+                std::format_to(std::back_inserter(record), format, std::forward<Args>(args)...);
+                SubmitLogRecord(std::move(record));
+            } // if level is compiled in
+            else {
+                static_cast<void>(format);
+                (static_cast<void>(args), ...);
+            } // else level is compiled out
+        }
+
+        template<typename... Args>
+        void LogTrace(std::format_string<Args...> format, Args&&... args) const {
+            Log<LogLevel::Trace>(format, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void LogDebug(std::format_string<Args...> format, Args&&... args) const {
+            Log<LogLevel::Debug>(format, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void LogInfo(std::format_string<Args...> format, Args&&... args) const {
+            Log<LogLevel::Info>(format, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void LogWarning(std::format_string<Args...> format, Args&&... args) const {
+            Log<LogLevel::Warning>(format, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        void LogError(std::format_string<Args...> format, Args&&... args) const {
+            Log<LogLevel::Error>(format, std::forward<Args>(args)...);
+        }
+
+        [[nodiscard]] std::string_view GetLogSource() const;
 
     private:
+        [[nodiscard]] bool IsLogLevelEnabled(LogLevel level) const;
+
+        // Timestamp, level, thread and source, ready for the message to be appended
+        [[nodiscard]] std::string BeginLogRecord(LogLevel level) const;
+
+        void SubmitLogRecord(std::string record) const;
+
         LogSystem& logSystem;
+        std::string_view source;
     };
 }
 
+// Trace & Debug records through logger (any LogInterface); below MinLogLevel they expand to nothing, so not even their
+// arguments are evaluated
+#ifdef NDEBUG
+#define FARCICAL_LOG_TRACE(logger, ...) static_cast<void>(0)
+#define FARCICAL_LOG_DEBUG(logger, ...) static_cast<void>(0)
+#else
+#define FARCICAL_LOG_TRACE(logger, ...) (logger).LogTrace(__VA_ARGS__)
+#define FARCICAL_LOG_DEBUG(logger, ...) (logger).LogDebug(__VA_ARGS__)
+#endif
+
 #endif //LOG_INTERFACE_HPP
@@ -0,0 +1,106 @@
+//
+// Created by dgmuller on 9/8/25.
+//
+
+#ifndef LOG_WRITER_HPP
+#define LOG_WRITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "error.hpp"
+#include "mpscQueue.hpp"
+
+namespace farcical::engine {
+    // When the current file would grow past maxFileSize it is renamed to <stem>.1<ext>, older files move up one
+    // number, and anything beyond maxNumFiles (counting the current file) is deleted. maxFileSize == 0 never rotates.
+    struct LogRotation {
+        std::uintmax_t maxFileSize;
+        std::size_t maxNumFiles;
+
+        static constexpr std::uintmax_t DefaultMaxFileSize = 4 * 1024 * 1024;
+        static constexpr std::size_t DefaultMaxNumFiles = 5;
+    };
+
+    // Appends lines to a log file from a dedicated thread. Producers only push onto a lock-free queue; the writer
+    // thread keeps the file open, gathers lines into one large chunk and writes it out once FlushSize bytes have
+    // accumulated, FlushInterval has passed, or a flush was requested. It sleeps in between, so an idle log costs
+    // one wake per FlushInterval.
+    class LogWriter {
+    public:
+        static constexpr std::size_t FlushSize = 64 * 1024;
+        static constexpr std::chrono::milliseconds FlushInterval{1000};
+
+        LogWriter();
+
+        ~LogWriter();
+
+        LogWriter(const LogWriter&) = delete;
+
+        LogWriter& operator=(const LogWriter&) = delete;
+
+        // Open (creating if necessary) the file at path for appending, and start the writer thread. The existing
+        // contents are never read. Lines pushed before Open are kept and written once it succeeds.
+        std::optional<Error> Open(std::string_view path,
+                                  LogRotation rotation = {LogRotation::DefaultMaxFileSize,
+                                                          LogRotation::DefaultMaxNumFiles});
+
+        // Write everything still queued, then stop the writer thread and close the file
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const;
+
+        // Safe to call from any thread
+        void Push(std::string line);
+
+        // Block until every line pushed before this call is on disk. Returns immediately if the writer isn't running.
+        void Flush();
+
+        // Path of the index'th rotated file: log.txt becomes log.1.txt, log.2.txt, ... (index 0 is path itself)
+        static std::filesystem::path GetRotatedPath(const std::filesystem::path& path, std::size_t index);
+
+        // Read the last numLines lines of the file at path by seeking backwards from its end, so the cost depends on
+        // numLines rather than the size of the file. Lines are returned oldest first.
+        static std::expected<std::vector<std::string>, Error> ReadTail(std::string_view path, std::size_t numLines);
+
+    private:
+        void Run();
+
+        // Writer thread only: move queued lines into chunk, writing it out whenever it fills up
+        void Drain();
+
+        // Writer thread only: write chunk to the file and flush it, rotating first if it would grow too large
+        void WriteChunk();
+
+        // Writer thread only: close the file, shift the older files along and reopen an empty one
+        void Rotate();
+
+        MPSCQueue<std::string> queue;
+        // Bytes pushed but not yet drained; the push that takes it past FlushSize wakes the writer early
+        std::atomic<std::size_t> numQueuedBytes;
+        std::filesystem::path path;
+        LogRotation rotation;
+        std::ofstream file;
+        std::uintmax_t fileSize;
+        std::string chunk;
+        std::thread thread;
+        std::atomic<bool> isRunning;
+
+        std::mutex mutex;
+        std::condition_variable wakeCondition;
+        std::condition_variable flushedCondition;
+        std::uint64_t numFlushesRequested;
+        std::uint64_t numFlushesCompleted;
+    };
+}
+
+#endif //LOG_WRITER_HPP
@@ -0,0 +1,64 @@
+//
+// Created by dgmuller on 9/10/25.
+//
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include "error.hpp"
+
+namespace farcical::engine {
+    // A file mapped into memory. Pages written through a ReadWrite mapping belong to the operating system, so they
+    // reach the file even if the process crashes before Flush or Close.
+    class MappedFile {
+    public:
+        enum class Mode {
+            ReadOnly,
+            ReadWrite
+        };
+
+        MappedFile();
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept;
+
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        // ReadOnly maps the whole of an existing file and ignores size. ReadWrite creates the file if necessary and
+        // resizes it to size bytes (which must be > 0) before mapping it.
+        std::optional<Error> Open(std::string_view path, Mode mode, std::size_t size = 0);
+
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const;
+
+        [[nodiscard]] std::byte* GetData();
+
+        [[nodiscard]] const std::byte* GetData() const;
+
+        [[nodiscard]] std::size_t GetSize() const;
+
+        // Ask the OS to start writing dirty pages back to the file; doesn't wait for them
+        void Flush();
+
+    private:
+        std::byte* data;
+        std::size_t size;
+#ifdef _WIN32
+        void* fileHandle;
+        void* mappingHandle;
+#else
+        int fileDescriptor;
+#endif
+    };
+}
+
+#endif //MAPPED_FILE_HPP
@@ -0,0 +1,72 @@
+//
+// Created by dgmuller on 9/8/25.
+//
+
+#ifndef MPSC_QUEUE_HPP
+#define MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace farcical::engine {
+    // Unbounded lock-free queue for any number of producer threads and exactly one consumer thread. Push is a single
+    // atomic exchange (plus the node's allocation) and never blocks or waits on the consumer. Messages from one
+    // producer are popped in the order that producer pushed them.
+    template<typename T>
+    class MPSCQueue {
+    public:
+        MPSCQueue() : head{new Node{}} {
+            tail = head.load(std::memory_order_relaxed);
+        }
+
+        ~MPSCQueue() {
+            while(Pop().has_value()) {
+            } // while queue is not empty
+            delete tail;
+        }
+
+        MPSCQueue(const MPSCQueue&) = delete;
+
+        MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+        // Safe to call from any thread
+        void Push(T value) {
+            Node* node{new Node{}};
+            node->value.emplace(std::move(value));
+            Node* previous{head.exchange(node, std::memory_order_acq_rel)};
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        // Consumer thread only. Returns std::nullopt if the queue is empty, or if a producer is midway through a Push
+        // (its value will be returned by a later call).
+        std::optional<T> Pop() {
+            Node* next{tail->next.load(std::memory_order_acquire)};
+            if(!next) {
+                return std::nullopt;
+            } // if queue is empty
+            std::optional<T> value{std::move(next->value)};
+            next->value.reset();
+            delete tail;
+            tail = next;
+            return value;
+        }
+
+        // Consumer thread only
+        [[nodiscard]] bool IsEmpty() const {
+            return tail->next.load(std::memory_order_acquire) == nullptr;
+        }
+
+    private:
+        // The consumer always holds one node whose value has already been taken (initially an empty stub)
+        struct Node {
+            std::atomic<Node*> next{nullptr};
+            std::optional<T> value;
+        };
+
+        std::atomic<Node*> head;
+        Node* tail;
+    };
+}
+
+#endif //MPSC_QUEUE_HPP
@@ -0,0 +1,120 @@
+//
+// Created by dgmuller on 9/7/25.
+//
+
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include "error.hpp"
+
+namespace farcical::engine {
+    // One timed scope. Times are in microseconds since the Profiler was created.
+    struct ProfileSample {
+        // Must be a string literal (or otherwise outlive the Profiler)
+        const char* name;
+        std::int64_t start;
+        std::int64_t duration;
+        std::uint32_t threadID;
+    };
+
+    struct ProfileFrame {
+        std::uint64_t index;
+        std::int64_t start;
+        std::int64_t duration;
+        std::vector<ProfileSample> samples;
+    };
+
+    // Collects scoped timings into a rolling history of the last HistorySize frames, which can be written out in
+    // Chrome's trace_event format (open it in chrome://tracing or ui.perfetto.dev). Instrument code through the
+    // FARCICAL_PROFILE_* macros below, which compile to nothing unless FARCICAL_ENABLE_PROFILER is defined.
+    class Profiler {
+    public:
+        static constexpr std::size_t HistorySize = 300;
+
+        static Profiler& Get();
+
+        Profiler(const Profiler&) = delete;
+
+        Profiler& operator=(const Profiler&) = delete;
+
+        void BeginFrame();
+
+        void EndFrame();
+
+        void AddSample(const char* name, std::int64_t start, std::int64_t duration);
+
+        [[nodiscard]] std::int64_t GetTime() const;
+
+        // Number of completed frames still in the history
+        [[nodiscard]] std::size_t GetNumFrames() const;
+
+        // 0 is the most recently completed frame. Returns a copy, since EndFrame may overwrite the history slot at any
+        // time; nullopt if the history doesn't reach back that far.
+        [[nodiscard]] std::optional<ProfileFrame> GetFrame(std::size_t framesAgo) const;
+
+        // Write every frame in the history, plus anything recorded since the last one ended, as trace_event JSON
+        std::optional<Error> WriteTrace(std::string_view path) const;
+
+    private:
+        Profiler();
+
+        const std::chrono::steady_clock::time_point startTime;
+        // Guards everything below; scopes may close on worker threads
+        mutable std::mutex mutex;
+        std::array<ProfileFrame, HistorySize> history;
+        std::uint64_t numFrames;
+        ProfileFrame currentFrame;
+    };
+
+    // Records the time between its construction and destruction as one sample
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char* name) : name{name}, start{Profiler::Get().GetTime()} {
+        }
+
+        ~ProfileScope() {
+            Profiler& profiler{Profiler::Get()};
+            profiler.AddSample(name, start, profiler.GetTime() - start);
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* name;
+        std::int64_t start;
+    };
+
+    // Marks the lifetime of one iteration of the main loop
+    class ProfileFrameScope {
+    public:
+        ProfileFrameScope() { Profiler::Get().BeginFrame(); }
+
+        ~ProfileFrameScope() { Profiler::Get().EndFrame(); }
+
+        ProfileFrameScope(const ProfileFrameScope&) = delete;
+
+        ProfileFrameScope& operator=(const ProfileFrameScope&) = delete;
+    };
+}
+
+#ifdef FARCICAL_ENABLE_PROFILER
+#define FARCICAL_PROFILE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define FARCICAL_PROFILE_CONCAT(lhs, rhs) FARCICAL_PROFILE_CONCAT_IMPL(lhs, rhs)
+#define FARCICAL_PROFILE_SCOPE(name) \
+    const farcical::engine::ProfileScope FARCICAL_PROFILE_CONCAT(profileScope, __LINE__){name}
+#define FARCICAL_PROFILE_FRAME() const farcical::engine::ProfileFrameScope profileFrameScope{}
+#else
+#define FARCICAL_PROFILE_SCOPE(name) static_cast<void>(0)
+#define FARCICAL_PROFILE_FRAME() static_cast<void>(0)
+#endif
+
+#endif //PROFILER_HPP
@@ -0,0 +1,144 @@
+//
+// Created by dgmuller on 9/6/25.
+//
+
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace farcical::engine {
+    // Refers to an element of a SlotMap. A slot's generation is bumped whenever its element is removed, so a handle
+    // to a destroyed element never resolves to whatever is stored in that slot later.
+    struct Handle {
+        std::uint32_t index{0};
+        std::uint32_t generation{0};
+
+        [[nodiscard]] constexpr bool IsValid() const { return generation != 0; }
+
+        constexpr bool operator==(const Handle& rhs) const = default;
+    };
+
+    // Densely packed storage with stable handles: elements live contiguously (so iteration is a linear walk in memory
+    // order), insertion and removal are O(1), and removal swaps the last element into the hole. Element order is
+    // therefore not preserved, and pointers to elements are invalidated by any insertion or removal; hold a Handle
+    // instead.
+    template<typename T>
+    class SlotMap {
+    public:
+        using Iterator = typename std::vector<T>::iterator;
+        using ConstIterator = typename std::vector<T>::const_iterator;
+
+        SlotMap() = default;
+
+        ~SlotMap() = default;
+
+        SlotMap(const SlotMap&) = delete;
+
+        SlotMap& operator=(const SlotMap&) = delete;
+
+        template<typename... Args>
+        Handle Emplace(Args&&... args) {
+            std::uint32_t slotIndex;
+            if(!freeSlots.empty()) {
+                slotIndex = freeSlots.back();
+                freeSlots.pop_back();
+            } // if a slot can be reused
+            else {
+                slotIndex = static_cast<std::uint32_t>(slots.size());
+                slots.push_back(Slot{0, 1});
+            } // else add a new slot
+            Slot& slot{slots[slotIndex]};
+            slot.denseIndex = static_cast<std::uint32_t>(elements.size());
+            elements.emplace_back(std::forward<Args>(args)...);
+            owners.push_back(slotIndex);
+            return Handle{slotIndex, slot.generation};
+        }
+
+        // Returns false if the handle was stale or invalid
+        bool Remove(Handle handle) {
+            if(!Contains(handle)) {
+                return false;
+            } // if handle does not refer to a live element
+            Slot& slot{slots[handle.index]};
+            const std::uint32_t denseIndex{slot.denseIndex};
+            const std::uint32_t lastIndex{static_cast<std::uint32_t>(elements.size()) - 1};
+            if(denseIndex != lastIndex) {
+                elements[denseIndex] = std::move(elements[lastIndex]);
+                owners[denseIndex] = owners[lastIndex];
+                slots[owners[denseIndex]].denseIndex = denseIndex;
+            } // if the removed element was not the last one
+            elements.pop_back();
+            owners.pop_back();
+            // Generation 0 is reserved for invalid handles
+            if(++slot.generation == 0) {
+                slot.generation = 1;
+            } // if generation wrapped around
+            freeSlots.push_back(handle.index);
+            return true;
+        }
+
+        [[nodiscard]] bool Contains(Handle handle) const {
+            return handle.IsValid() && handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+        }
+
+        [[nodiscard]] T* Get(Handle handle) {
+            return Contains(handle) ? &elements[slots[handle.index].denseIndex] : nullptr;
+        }
+
+        [[nodiscard]] const T* Get(Handle handle) const {
+            return Contains(handle) ? &elements[slots[handle.index].denseIndex] : nullptr;
+        }
+
+        // Handle for the element currently stored at the given position in iteration order
+        [[nodiscard]] Handle GetHandle(std::size_t denseIndex) const {
+            const std::uint32_t slotIndex{owners[denseIndex]};
+            return Handle{slotIndex, slots[slotIndex].generation};
+        }
+
+        [[nodiscard]] T& operator[](std::size_t denseIndex) { return elements[denseIndex]; }
+        [[nodiscard]] const T& operator[](std::size_t denseIndex) const { return elements[denseIndex]; }
+
+        [[nodiscard]] std::size_t size() const { return elements.size(); }
+        [[nodiscard]] bool empty() const { return elements.empty(); }
+
+        void reserve(std::size_t capacity) {
+            elements.reserve(capacity);
+            owners.reserve(capacity);
+            slots.reserve(capacity);
+        }
+
+        void clear() {
+            for(const auto& slotIndex: owners) {
+                Slot& slot{slots[slotIndex]};
+                if(++slot.generation == 0) {
+                    slot.generation = 1;
+                } // if generation wrapped around
+                freeSlots.push_back(slotIndex);
+            } // for each live slot
+            elements.clear();
+            owners.clear();
+        }
+
+        Iterator begin() { return elements.begin(); }
+        Iterator end() { return elements.end(); }
+        ConstIterator begin() const { return elements.begin(); }
+        ConstIterator end() const { return elements.end(); }
+
+    private:
+        struct Slot {
+            std::uint32_t denseIndex;
+            std::uint32_t generation;
+        };
+
+        std::vector<T> elements;
+        // The slot that owns each element, so a swap-remove can redirect the moved element's slot
+        std::vector<std::uint32_t> owners;
+        std::vector<Slot> slots;
+        std::vector<std::uint32_t> freeSlots;
+    };
+}
+
+#endif //SLOT_MAP_HPP
@@ -37,13 +37,15 @@ namespace farcical::engine {
 
         void Enqueue(const Event& event);
 
+        [[nodiscard]] bool IsQueueEmpty() const;
+
         void Init() override;
 
         void Update() override;
 
         void Stop() override;
 
-        std::expected<EventComponent*, Error> CreateEventComponent(
+        std::expected<ComponentHandle, Error> CreateEventComponent(
             const std::vector<Event::Type>& handledTypes, EventHandler* handler, EntityID parentID);
 
         std::optional<Error> DestroyEventComponent(EntityID parentID);
@@ -54,7 +56,8 @@ namespace farcical::engine {
 
         std::vector<Event> eventQueue;
 
-        std::unordered_map<EntityID, std::unique_ptr<EventComponent> > components;
+        SlotMap<EventComponent> components;
+        std::unordered_map<EntityID, ComponentHandle> handles;
 
         using EventHandlerList = std::vector<EventHandler*>;
         std::array<EventHandlerList, static_cast<int>(Event::Type::NumEventTypes)> handlers;
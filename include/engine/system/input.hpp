@@ -5,16 +5,26 @@
 #ifndef INPUT_SYSTEM_HPP
 #define INPUT_SYSTEM_HPP
 
+#include <cstdint>
 #include <expected>
 #include <unordered_map>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/Window/Event.hpp>
 
 #include "log.hpp"
 #include "system.hpp"
 #include "../component/input.hpp"
 #include "../error.hpp"
+#include "../inputBuffer.hpp"
 
 namespace farcical::engine {
+    // Time between an event being drained from the window's queue and reaching its listeners
+    struct InputLatency {
+        sf::Time max;
+        sf::Time total;
+        std::uint64_t numEvents;
+    };
+
     class InputSystem final : public System {
     public:
         InputSystem() = delete;
@@ -23,7 +33,7 @@ namespace farcical::engine {
 
         InputSystem(const InputSystem&) = delete;
 
-        explicit InputSystem(sf::RenderWindow& window, LogSystem& logSystem, ErrorGenerator* errorGenerator);
+        explicit InputSystem(InputBuffer& inputBuffer, LogSystem& logSystem, ErrorGenerator* errorGenerator);
 
         ~InputSystem() override = default;
 
@@ -33,16 +43,59 @@ namespace farcical::engine {
 
         void Stop() override;
 
-        std::expected<InputComponent*, Error> CreateInputComponent(
-            MouseInterface* mouse, KeyboardInterface* keyboard, EntityID parentID);
+        // Dispatch a single window event to the mouse & keyboard listeners
+        void HandleEvent(const sf::Event& event);
+
+        [[nodiscard]] const InputLatency& GetLatency() const;
+
+        // Mouse events are delivered only while the cursor is within bounds (or has just left them);
+        // a component with empty bounds receives every mouse event
+        std::expected<ComponentHandle, Error> CreateInputComponent(
+            MouseInterface* mouse, KeyboardInterface* keyboard, EntityID parentID, sf::IntRect bounds = {});
 
         std::optional<Error> DestroyInputComponent(EntityID parentID);
 
+        // Returns nullptr if the handle is stale. The pointer is only valid until the next InputComponent is created
+        // or destroyed.
+        [[nodiscard]] InputComponent* GetInputComponent(ComponentHandle handle);
+
+        // Call when a widget with an InputComponent moves or is resized
+        std::optional<Error> SetInputBounds(EntityID parentID, sf::IntRect bounds);
+
+        // Number of MouseMoved events that were superseded by a later one before they were dispatched
+        [[nodiscard]] std::uint64_t GetNumMovesCoalesced() const;
+
     private:
-        sf::RenderWindow& window;
-        std::unordered_map<EntityID, std::unique_ptr<InputComponent> > components;
-        std::vector<MouseInterface*> mouseListeners;
+        // Side length, in pixels, of each cell in the uniform grid used to find the components under the cursor
+        static constexpr int GridCellSize = 64;
+
+        using GridCell = std::vector<ComponentHandle>;
+
+        static int GetCellIndex(int coordinate);
+
+        static std::uint64_t GetCellKey(int cellX, int cellY);
+
+        void AddToGrid(ComponentHandle handle, const InputComponent& component);
+
+        void RemoveFromGrid(ComponentHandle handle, const InputComponent& component);
+
+        // Send a mouse event to the components under the cursor, and to any that the cursor has just left
+        void DispatchMouseEvent(const sf::Event& event, sf::Vector2i position);
+
+        InputBuffer& inputBuffer;
+        InputLatency latency;
+        std::uint64_t numMovesCoalesced;
+        SlotMap<InputComponent> components;
+        std::unordered_map<EntityID, ComponentHandle> handles;
         std::vector<KeyboardInterface*> keyboardListeners;
+
+        std::unordered_map<std::uint64_t, GridCell> grid;
+        // Components without bounds, which receive every mouse event
+        std::vector<ComponentHandle> unboundedListeners;
+        // Components that were under the cursor when the last mouse event was dispatched
+        std::vector<ComponentHandle> hovered;
+        // Reused each dispatch to avoid allocating
+        std::vector<ComponentHandle> targets;
     };
 }
 
@@ -0,0 +1,133 @@
+//
+// Created by dgmuller on 9/12/25.
+//
+
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "system.hpp"
+
+namespace farcical::engine {
+    using Job = std::function<void()>;
+
+    // Counts unfinished jobs. Pass one to JobSystem::Submit to track a group of jobs, then Wait on it, or make other
+    // jobs depend on it. Always Wait on a counter before destroying it, even if IsDone.
+    class JobCounter {
+    public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter&) = delete;
+
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        [[nodiscard]] bool IsDone() const { return count.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+
+        struct Continuation {
+            Job job;
+            JobCounter* counter;
+        };
+
+        std::atomic<std::size_t> count{0};
+        // Guards the final decrement & continuations; Wait takes it last, so it can't return while Finish is inside
+        std::mutex mutex;
+        std::vector<Continuation> continuations;
+    };
+
+    // Runs jobs on one worker thread per core (less one for the main thread, which helps out while it Waits). Each
+    // worker has its own deque: it takes its newest job first, and when it runs dry it steals the oldest job from
+    // another worker, so the fan-out of one job tends to stay on one core while idle cores still pick up slack.
+    class JobSystem final : public System {
+    public:
+        static unsigned int GetDefaultNumWorkers();
+
+        JobSystem() = delete;
+
+        JobSystem(LogSystem& logSystem, ErrorGenerator* errorGenerator, unsigned int numWorkers = GetDefaultNumWorkers());
+
+        ~JobSystem() override;
+
+        JobSystem(const JobSystem&) = delete;
+
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        void Init() override;
+
+        void Update() override;
+
+        void Stop() override;
+
+        [[nodiscard]] unsigned int GetNumWorkers() const;
+
+        // Safe to call from any thread, including from inside a job. Without workers (before Init or after Stop) the
+        // job runs immediately on the calling thread.
+        void Submit(Job job, JobCounter* counter = nullptr);
+
+        // Run job only once dependency has reached zero
+        void Submit(Job job, JobCounter* counter, JobCounter& dependency);
+
+        // Run other jobs on this thread until counter reaches zero
+        void Wait(JobCounter& counter);
+
+        // Call body(begin, end) over [0, count) split into ranges of about grainSize, and wait for all of them
+        template<typename Body>
+        void ParallelFor(std::size_t count, std::size_t grainSize, Body&& body) {
+            grainSize = std::max<std::size_t>(grainSize, 1);
+            if(count <= grainSize || workers.empty()) {
+                body(std::size_t{0}, count);
+                return;
+            } // if there is only one range, or no workers to share it with
+            JobCounter counter;
+            for(std::size_t begin = grainSize; begin < count; begin += grainSize) {
+                const std::size_t end{std::min(begin + grainSize, count)};
+                Submit([&body, begin, end]() { body(begin, end); }, &counter);
+            } // for each range but the first
+            body(std::size_t{0}, grainSize);
+            Wait(counter);
+        }
+
+    private:
+        struct Worker {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+            std::thread thread;
+        };
+
+        void Run(std::size_t workerIndex);
+
+        // Take a job from workerIndex's own deque, or else steal one; workerIndex may be NoWorker
+        bool TryRunJob(std::size_t workerIndex);
+
+        // Like Submit, but counter has already been counted
+        void Schedule(Job job, JobCounter* counter);
+
+        void Push(Job job);
+
+        void Finish(JobCounter* counter);
+
+        static constexpr std::size_t NoWorker = static_cast<std::size_t>(-1);
+
+        const unsigned int numWorkers;
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<std::size_t> nextWorker;
+        std::atomic<std::size_t> numQueued;
+        std::atomic<bool> isStopping;
+
+        std::mutex sleepMutex;
+        std::condition_variable wakeCondition;
+    };
+}
+
+#endif //JOB_SYSTEM_HPP
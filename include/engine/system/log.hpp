@@ -5,8 +5,12 @@
 #ifndef LOG_SYSTEM_HPP
 #define LOG_SYSTEM_HPP
 
+#include <atomic>
+#include <expected>
 #include <vector>
 #include "system.hpp"
+#include "../flightRecorder.hpp"
+#include "../logWriter.hpp"
 #include "../../resource/resource.hpp"
 
 namespace farcical {
@@ -14,19 +18,25 @@ namespace farcical {
 }
 
 namespace farcical::engine {
-    struct Log {
-        ResourceParameters resource;
-        std::vector<std::string> contents;
-    };
-
     class LogSystem final : public System {
     public:
         LogSystem() = delete;
 
-        LogSystem(ResourceID logID, std::string_view logPath);
+        static constexpr std::string_view FlightRecorderFileName{"flightRecorder.ring"};
+
+        // flightRecorderSize > 0 also keeps the most recent records in a crash-safe FlightRecorder of that many bytes,
+        // next to the log file
+        LogSystem(ResourceID logID,
+                  std::string_view logPath,
+                  LogRotation rotation = {LogRotation::DefaultMaxFileSize, LogRotation::DefaultMaxNumFiles},
+                  std::uint32_t flightRecorderSize = 0);
 
         ~LogSystem() override = default;
 
+        LogSystem(const LogSystem&) = delete;
+
+        LogSystem& operator=(const LogSystem&) = delete;
+
         void Init() override;
 
         void Update() override;
@@ -35,13 +45,32 @@ namespace farcical::engine {
 
         void AddResourceManager(ResourceManager* resourceManager);
 
-        void AddMessage(std::string_view message);
+        // Safe to call from any thread; the line is copied into the flight recorder (if there is one) and queued for
+        // the writer thread. Written as-is: use the LogInterface functions for timestamped, leveled records.
+        void AddMessage(std::string message);
+
+        // Records below level are dropped before they are formatted. Levels below MinLogLevel are always dropped.
+        void SetLevel(LogLevel level);
+
+        [[nodiscard]] LogLevel GetLevel() const;
+
+        [[nodiscard]] bool IsLevelEnabled(LogLevel level) const;
+
+        // Block until every message added so far has been written to disk
+        void Flush();
+
+        // The last numLines messages in the current log file, oldest first. Flushes first, so it includes everything
+        // added so far.
+        std::expected<std::vector<std::string>, Error> GetRecentMessages(std::size_t numLines);
 
     private:
         ResourceParameters logParams;
+        LogRotation rotation;
         ResourceManager* resourceManager;
-        Log* log;
-        std::vector<std::string> buffer;
+        LogWriter writer;
+        std::uint32_t flightRecorderSize;
+        FlightRecorder flightRecorder;
+        std::atomic<LogLevel> level;
     };
 }
 
@@ -33,6 +33,9 @@ namespace farcical::engine {
 
         void ClearCurrentMusic();
 
+        // True between a change of track or playback state and the next Update()
+        [[nodiscard]] bool IsTransitionPending() const;
+
         void Init() override;
 
         void Update() override;
@@ -43,6 +46,7 @@ namespace farcical::engine {
         ResourceManager& resourceManager;
         ResourceHandle* currentMusicHandle;
         sf::Music* currentMusic;
+        bool isTransitionPending;
     };
 }
 
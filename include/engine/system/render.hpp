@@ -5,9 +5,13 @@
 #ifndef RENDER_SYSTEM_HPP
 #define RENDER_SYSTEM_HPP
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
 #include "../component/render.hpp"
 #include "log.hpp"
 #include "system.hpp"
@@ -15,27 +19,25 @@
 #include "../../resource/config.hpp"
 
 namespace farcical::engine {
+    // One draw call: either every sprite sharing a texture (as textured triangles), or a single text component
+    struct RenderBatch {
+        sf::Texture* texture;
+        ComponentHandle text;
+        sf::VertexArray vertices;
+        sf::FloatRect bounds;
+        int numComponents;
+    };
+
+    // The components themselves live in RenderSystem's SlotMap; a layer only keeps the batches built from them
     struct RenderLayer {
         ui::Layout::Layer::ID id;
-        std::vector<RenderComponent*> componentList;
-
-        void Add(RenderComponent* component) {
-            componentList.push_back(component);
-        }
-
-        void Remove(EntityID parentID) {
-            for(auto componentIter = componentList.begin();
-                componentIter != componentList.end(); ++componentIter) {
-                if((*componentIter)->parentID == parentID) {
-                    componentList.erase(componentIter);
-                    return;
-                } // if IDs match
-            } // for each component in componentList
-        }
-
-        void Clear() {
-            componentList.clear();
-        }
+        int numComponents{0};
+        std::vector<RenderBatch> batches;
+        // Batches must be rebuilt if a component was added, removed or changed
+        bool isDirty{true};
+        // Cached layers are rendered offscreen only when they change, then composited with a single draw
+        bool isCached{false};
+        std::unique_ptr<sf::RenderTexture> cache;
     };
 
     struct RenderContext {
@@ -72,14 +74,21 @@ namespace farcical::engine {
         RenderContext* GetRenderContext(engine::EntityID sceneID) const;
 
         // Create RenderComponent for Sprite
-        std::expected<RenderComponent*, Error> CreateRenderComponent(
+        std::expected<ComponentHandle, Error> CreateRenderComponent(
             ui::Layout::Layer::ID layerID,
             EntityID sceneID,
             EntityID parentID,
             sf::Texture* texture);
 
+        // Create RenderComponent for a Border drawn as a NineSlice; its edge & center Textures are set to repeat
+        std::expected<ComponentHandle, Error> CreateRenderComponent(
+            ui::Layout::Layer::ID layerID,
+            EntityID sceneID,
+            EntityID parentID,
+            const NineSlice& nineSlice);
+
         // Create RenderComponent for Text
-        std::expected<RenderComponent*, Error> CreateRenderComponent(
+        std::expected<ComponentHandle, Error> CreateRenderComponent(
             ui::Layout::Layer::ID layerID,
             EntityID sceneID,
             EntityID parentID,
@@ -89,10 +98,68 @@ namespace farcical::engine {
 
         std::optional<Error> DestroyRenderComponent(EntityID sceneID, EntityID parentID);
 
+        // Returns nullptr if the handle is stale. The pointer is only valid until the next RenderComponent is created
+        // or destroyed.
+        [[nodiscard]] RenderComponent* GetRenderComponent(ComponentHandle handle);
+
+        // Render the given layer offscreen and composite it as one quad, re-rendering only when it changes
+        std::optional<Error> SetLayerCached(EntityID sceneID, ui::Layout::Layer::ID layerID, bool isCached);
+
+        // True if the next frame would differ from what is currently on screen
+        bool IsDirty() const;
+
+        // Force the next frame to be drawn, e.g. after the window was resized or regained focus
+        void RequestRedraw();
+
+        // Fraction of a simulation tick (0 to 1) that has elapsed since the last Game::Update, for drawing moving
+        // objects between their previous and current simulated positions
+        void SetInterpolationAlpha(float alpha);
+
+        [[nodiscard]] float GetInterpolationAlpha() const;
+
+        // Number of draw calls issued during the last frame
+        int GetNumDrawCalls() const;
+
+        // Number of draw calls batching avoided during the last frame, compared to one draw per component
+        int GetNumDrawCallsSaved() const;
+
     private:
+        // Transfer each changed component's dirty flag to the layer it is drawn in
+        void MarkDirtyLayers();
+
+        // Group a layer's components into as few draw calls as possible without changing what ends up on screen
+        void BuildBatches(EntityID sceneID, RenderLayer& layer);
+
+        // Add a textured quad to the last batch it can join without changing what ends up on screen, or to a new one.
+        // textureRect is in texels and may extend past the Texture if it repeats.
+        RenderBatch& AppendQuad(RenderLayer& layer,
+                                sf::Texture* texture,
+                                const sf::FloatRect& bounds,
+                                const sf::FloatRect& textureRect);
+
+        // Add the (at most 9) quads of a NineSlice component, laid out the way Compositor::NineSlice bakes a Border
+        void AppendNineSlice(RenderLayer& layer, const RenderComponent& component);
+
+        // Issue one draw per batch in the given layer
+        void DrawBatches(sf::RenderTarget& target, const RenderLayer& layer);
+
+        // Re-render a cached layer into its RenderTexture, (re)creating it if the window size changed
+        std::optional<Error> UpdateLayerCache(RenderLayer& layer);
+
         sf::RenderWindow& window;
         std::vector<RenderContext> contexts;
-        std::unordered_map<EntityID, std::unique_ptr<RenderComponent> > components;
+        SlotMap<RenderComponent> components;
+        std::unordered_map<EntityID, ComponentHandle> handles;
+        std::uint64_t nextSequence;
+        // Reused by BuildBatches to avoid allocating
+        std::vector<std::size_t> drawOrder;
+
+        bool needsRedraw;
+        float interpolationAlpha;
+        int numDrawCalls;
+        int numDrawCallsSaved;
+        std::uint64_t totalDrawCallsSaved;
+        std::uint64_t numFrames;
     };
 };
 
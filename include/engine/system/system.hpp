@@ -5,6 +5,7 @@
 #ifndef SYSTEM_HPP
 #define SYSTEM_HPP
 
+#include <string_view>
 #include "../error.hpp"
 #include "../logInterface.hpp"
 
@@ -16,13 +17,14 @@ namespace farcical::engine {
             RenderSystem,
             InputSystem,
             EventSystem,
-            MusicSystem
+            MusicSystem,
+            JobSystem
         };
 
         System() = delete;
 
         explicit System(const System::ID id, LogSystem& logSystem, ErrorGenerator* errorGenerator):
-            LogInterface(logSystem),
+            LogInterface(logSystem, GetName(id)),
             id{id},
             errorGenerator{errorGenerator} {
         }
@@ -35,6 +37,18 @@ namespace farcical::engine {
 
         [[nodiscard]] System::ID GetID() const { return id; }
 
+        static constexpr std::string_view GetName(System::ID id) {
+            switch(id) {
+                case ID::LogSystem: return "LogSystem";
+                case ID::RenderSystem: return "RenderSystem";
+                case ID::InputSystem: return "InputSystem";
+                case ID::EventSystem: return "EventSystem";
+                case ID::MusicSystem: return "MusicSystem";
+                case ID::JobSystem: return "JobSystem";
+            } // switch id
+            return "System";
+        }
+
         virtual void Init() = 0;
 
         virtual void Update() = 0;
@@ -0,0 +1,21 @@
+//
+// Created by dgmuller on 9/9/25.
+//
+
+#ifndef THREAD_INDEX_HPP
+#define THREAD_INDEX_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace farcical::engine {
+    // Small, stable number for the calling thread (0 for the first thread to ask), for tagging profiler samples and
+    // log records. Unlike std::thread::id it is cheap to print and reads the same in every tool.
+    inline std::uint32_t GetThreadIndex() {
+        static std::atomic<std::uint32_t> nextThreadIndex{0};
+        thread_local const std::uint32_t threadIndex{nextThreadIndex++};
+        return threadIndex;
+    }
+}
+
+#endif //THREAD_INDEX_HPP
@@ -58,6 +58,9 @@ namespace farcical::game {
 
         std::optional<engine::Error> Update();
 
+        // True if Update has anything to simulate; an idle Engine only wakes for simulation ticks while it does
+        [[nodiscard]] bool IsSimulating() const;
+
         std::optional<engine::Error> Stop();
 
         std::unique_ptr<World> CreateWorld();
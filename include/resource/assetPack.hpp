@@ -0,0 +1,91 @@
+//
+// Created by dgmuller on 9/15/25.
+//
+
+#ifndef ASSET_PACK_HPP
+#define ASSET_PACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../engine/error.hpp"
+#include "../engine/mappedFile.hpp"
+
+namespace farcical {
+    // Every asset the game ships with, packed into one file that is mapped into memory once. Find hands back a view
+    // straight into the mapping, which stays valid until Close, so Textures, Fonts & Music can be loaded from memory
+    // with no copy and no file of their own to open. Once Open has returned, Find & Verify only read, so they're safe
+    // to call from any thread.
+    //
+    // File layout: a Header, the Entry index (sorted by path), every path back to back, then the blobs, each starting
+    // on a BlobAlignment boundary. Identical files are stored once.
+    class AssetPack final {
+    public:
+        static constexpr char Magic[8] = {'F', 'A', 'R', 'C', 'P', 'A', 'C', 'K'};
+        static constexpr std::uint32_t Version = 1;
+        static constexpr std::uint64_t BlobAlignment = 64;
+
+        struct Header {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t numEntries;
+            std::uint64_t pathsOffset;
+            std::uint64_t pathsSize;
+        };
+
+        struct Entry {
+            std::uint64_t offset;
+            std::uint64_t size;
+            std::uint64_t contentHash;
+            std::uint32_t pathOffset;
+            std::uint32_t pathLength;
+        };
+
+        AssetPack() = default;
+
+        ~AssetPack() = default;
+
+        AssetPack(const AssetPack&) = delete;
+
+        AssetPack& operator=(const AssetPack&) = delete;
+
+        // Maps the pack at path and checks its index; nothing in it is read until it's asked for
+        std::optional<engine::Error> Open(std::string_view path);
+
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const;
+
+        // The contents of the file that was packed from path, or nullopt if it isn't in the pack
+        [[nodiscard]] std::optional<std::span<const std::byte>> Find(std::string_view path) const;
+
+        // Hashes the contents of path again and compares them with the hash recorded when it was packed
+        std::optional<engine::Error> Verify(std::string_view path) const;
+
+        [[nodiscard]] std::size_t GetNumEntries() const;
+
+        // Every packed path, in index order
+        [[nodiscard]] std::vector<std::string_view> GetPaths() const;
+
+        // Packs files (read from disk, and looked up later by the same paths) into a new pack at outputPath
+        static std::optional<engine::Error> Build(std::string_view outputPath, const std::vector<std::string>& files);
+
+        // Paths are looked up in the form they were packed in: "dat/./fonts/../fonts/a.ttf" finds "dat/fonts/a.ttf"
+        static std::string NormalizePath(std::string_view path);
+
+    private:
+        [[nodiscard]] const Entry* FindEntry(std::string_view normalizedPath) const;
+
+        [[nodiscard]] std::string_view GetPath(const Entry& entry) const;
+
+        engine::MappedFile mappedFile;
+        std::vector<Entry> entries;
+        std::string_view paths;
+    };
+}
+
+#endif //ASSET_PACK_HPP
@@ -0,0 +1,76 @@
+//
+// Created by dgmuller on 9/17/25.
+//
+
+#ifndef COMPOSITE_CACHE_HPP
+#define COMPOSITE_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <SFML/Graphics/Texture.hpp>
+#include "../engine/error.hpp"
+
+namespace farcical {
+    // Keeps the pixels of composite Textures (Spliced, Repeating, Overlay & Border) on disk between runs, keyed by a
+    // hash of everything that went into them: the generator, its parameters and the contents of every input file. A
+    // hit is uploaded straight from the mapped entry, skipping the GPU read-backs and compositing it would take to draw
+    // it again. Once the directory grows past maxSize, the least recently used entries are evicted; reading an entry
+    // counts as using it.
+    //
+    // File layout: a Header, then width * height RGBA pixels.
+    class CompositeCache {
+    public:
+        static constexpr char Magic[8] = {'F', 'A', 'R', 'C', 'C', 'O', 'M', 'P'};
+        static constexpr std::uint32_t Version = 2;
+        static constexpr std::uintmax_t DefaultMaxSize = 256 * 1024 * 1024;
+
+        struct Header {
+            char magic[8];
+            std::uint64_t key;
+            std::uint32_t version;
+            std::uint32_t width;
+            std::uint32_t height;
+            std::uint32_t reserved;
+        };
+
+        struct Statistics {
+            std::size_t numHits;
+            std::size_t numMisses;
+            std::size_t numWrites;
+            std::size_t numEvictions;
+        };
+
+        // An empty directory disables the cache
+        explicit CompositeCache(std::string_view directory = "", std::uintmax_t maxSize = DefaultMaxSize);
+
+        [[nodiscard]] bool IsEnabled() const;
+
+        // A missing or unreadable entry is a miss, reported as an error so the caller draws the Texture and Writes it
+        std::expected<sf::Texture, engine::Error> Read(std::uint64_t key);
+
+        // Store imageSize.x * imageSize.y RGBA pixels, evicting older entries if that makes the cache too big
+        std::optional<engine::Error> Write(std::uint64_t key,
+                                           const sf::Vector2u& imageSize,
+                                           const std::uint8_t* pixels);
+
+        [[nodiscard]] const Statistics& GetStatistics() const;
+
+    private:
+        [[nodiscard]] std::filesystem::path GetEntryPath(std::uint64_t key) const;
+
+        // Delete entries, least recently used first, until the directory fits in maxSize
+        void Evict();
+
+        std::filesystem::path directory;
+        std::uintmax_t maxSize;
+        // Bytes on disk; measured by the first Write, then kept up to date
+        std::optional<std::uintmax_t> size;
+        Statistics statistics;
+    };
+}
+
+#endif //COMPOSITE_CACHE_HPP
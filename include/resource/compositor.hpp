@@ -0,0 +1,76 @@
+//
+// Created by dgmuller on 9/18/25.
+//
+
+#ifndef COMPOSITOR_HPP
+#define COMPOSITOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace farcical {
+    // A canvas of RGBA8 pixels in CPU memory that the composite Texture generators assemble a whole Texture in, so it
+    // takes one upload instead of one Texture::update per tile & slice. Blending runs on AVX2 or SSE2 kernels when the
+    // CPU has them and on plain loops when it doesn't; every instruction set produces exactly the same pixels.
+    class Compositor {
+    public:
+        enum class InstructionSet {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+        // Tightly packed RGBA8 pixels, top row first. Doesn't own them.
+        struct View {
+            const std::uint8_t* pixels;
+            sf::Vector2u size;
+        };
+
+        static View ViewOf(const sf::Image& image);
+
+        // Transparent black
+        explicit Compositor(const sf::Vector2u& size);
+
+        [[nodiscard]] const sf::Vector2u& GetSize() const;
+
+        [[nodiscard]] View GetView() const;
+
+        // Copy source to position, clipped to the canvas
+        void Blit(const View& source, const sf::Vector2i& position);
+
+        // Fill area with copies of source starting from its top-left corner; the last column & row are cut short
+        void Tile(const View& source, const sf::IntRect& area);
+
+        // Multiply every pixel's alpha by opacity (0.0 - 1.0)
+        void ScaleAlpha(float opacity);
+
+        // Draw source over the canvas at position, blended the way sf::BlendAlpha blends a Sprite into a RenderTexture
+        void BlendOver(const View& source, const sf::Vector2i& position);
+
+        // Lay out a Border over the whole canvas: corners (Rectangle::Corner order) in the corners, edges
+        // (Rectangle::Edge order) tiled between them and center tiled inside them
+        void NineSlice(const std::array<View, 4>& corners, const std::array<View, 4>& edges, const View& center);
+
+        // Upload the canvas in one go; throws like sf::Texture's own constructors if the Texture can't be created
+        [[nodiscard]] sf::Texture CreateTexture() const;
+
+        // The kernels every Compositor uses. Benchmarks narrow it to compare them; asking for more than the CPU has
+        // gets the best it does have.
+        static void SetInstructionSet(InstructionSet instructionSet);
+
+        static InstructionSet GetInstructionSet();
+
+        static InstructionSet GetSupportedInstructionSet();
+
+    private:
+        sf::Vector2u size;
+        std::vector<std::uint8_t> pixels;
+    };
+}
+
+#endif //COMPOSITOR_HPP
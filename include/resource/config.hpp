@@ -245,6 +245,9 @@ namespace farcical {
     struct BorderTextureProperties: public ResourceProperties {
         float scale;
         sf::Vector2u percentSize;
+        // Draw the Border straight from its slices as a nine-slice RenderComponent instead of baking a window-sized
+        // Texture of it, so it costs the same VRAM at any size and nothing has to be redrawn when the window resizes
+        bool isNineSlice;
         std::array<TextureProperties, static_cast<int>(Rectangle::Corner::NumCorners)> cornerTextures;
         std::array<TextureProperties, static_cast<int>(Rectangle::Edge::NumEdges)> edgeTextures;
         TextureProperties centerTexture;
@@ -252,7 +255,8 @@ namespace farcical {
         BorderTextureProperties():
             ResourceProperties(ResourceHandle::Type::Texture),
             scale{1.0f},
-            percentSize{100, 100} {
+            percentSize{100, 100},
+            isNineSlice{false} {
         }
 
         BorderTextureProperties(    ResourceID id,
@@ -266,6 +270,7 @@ namespace farcical {
             ResourceProperties(id, ResourceHandle::Type::Texture, path, persist),
             scale{scale},
             percentSize{percentSize},
+            isNineSlice{false},
             centerTexture{centerTexture} {
             int cornerIndex = 0;
             for(const auto& corner: cornerTextures) {
@@ -0,0 +1,56 @@
+//
+// Created by dgmuller on 9/11/25.
+//
+
+#ifndef RESOURCE_LOADER_HPP
+#define RESOURCE_LOADER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace farcical {
+    // A small pool of worker threads that ResourceManager hands file reads and decodes to. Jobs must not touch
+    // anything the main thread owns (the registry, GPU resources); they report back through their own captures.
+    class ResourceLoader final {
+    public:
+        // Leave a core for the main thread, but always have at least one worker
+        static unsigned int GetDefaultNumThreads();
+
+        explicit ResourceLoader(unsigned int numThreads = GetDefaultNumThreads());
+
+        // Jobs that haven't started yet are discarded; running ones are finished
+        ~ResourceLoader();
+
+        ResourceLoader(const ResourceLoader&) = delete;
+
+        ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+        // Worker threads are started by the first Submit
+        void Submit(std::function<void()> job);
+
+        // Block until every submitted job has finished
+        void WaitIdle();
+
+        [[nodiscard]] unsigned int GetNumThreads() const;
+
+    private:
+        void Run();
+
+        const unsigned int numThreads;
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+        std::condition_variable jobAvailable;
+        std::condition_variable idle;
+        std::deque<std::function<void()>> jobs;
+        std::size_t numActiveJobs;
+        bool isStopping;
+    };
+}
+
+#endif //RESOURCE_LOADER_HPP
@@ -5,13 +5,29 @@
 #ifndef RESOURCE_MANAGER_HPP
 #define RESOURCE_MANAGER_HPP
 
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <expected>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
 #include <unordered_map>
+#include <variant>
+#include <vector>
 #include <nlohmann/json.hpp>
 #include <SFML/Audio/Music.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Time.hpp>
+#include "assetPack.hpp"
+#include "compositeCache.hpp"
+#include "compositor.hpp"
 #include "config.hpp"
+#include "loader.hpp"
 #include "resource.hpp"
 #include "../engine/error.hpp"
 #include "../engine/system/log.hpp"
@@ -27,6 +43,21 @@ namespace farcical {
 
         void Reset();
 
+        // From now on, every resource whose path is in the AssetPack at path is loaded straight from its mapping
+        // instead of opening a file. With looseOverride, a loose file that exists on disk still wins over its packed
+        // copy. Mounting another pack replaces this one, so call it before anything is loaded.
+        std::optional<engine::Error> MountAssetPack(std::string_view path, bool looseOverride);
+
+        // The packed contents of the file at path, or nullopt if it should be read from disk. Safe to call from the
+        // loader's threads; the view is valid until the pack is replaced or Reset.
+        [[nodiscard]] std::optional<std::span<const std::byte>> FindPackedAsset(std::string_view path) const;
+
+        // Keep the composite Textures the Create*Texture functions draw in directory between runs, up to maxSize bytes.
+        // An empty directory turns the cache off.
+        void SetCompositeCache(std::string_view directory, std::uintmax_t maxSize);
+
+        [[nodiscard]] const CompositeCache::Statistics& GetCompositeCacheStatistics() const;
+
         ResourceHandle* GetResourceHandle(ResourceID id) const;
 
         std::expected<ResourceHandle*, engine::Error> CreateResourceHandle(
@@ -36,8 +67,6 @@ namespace farcical {
 
         std::optional<engine::Error> DestroyResourceHandle(ResourceID id, ResourceHandle::Type type);
 
-        std::expected<engine::Log*, engine::Error> GetLog(ResourceID id);
-
         std::expected<nlohmann::json*, engine::Error> GetJSONDoc(ResourceID id);
 
         std::expected<sf::Font*, engine::Error> GetFont(ResourceID id);
@@ -52,11 +81,21 @@ namespace farcical {
 
         std::expected<sf::Texture*, engine::Error> GetTexture(SegmentedTextureProperties properties);
 
-        std::optional<engine::Error> WriteLog(ResourceID id, const std::vector<std::string>& messages);
+        // The Request*Async functions create the ResourceHandle if necessary, mark it Loading and read & decode the
+        // file on a worker thread. Poll the returned handle's status, or call the matching Get* function, which waits
+        // for that one resource. Requesting a resource that is already Loading or IsReady does nothing.
+        std::expected<ResourceHandle*, engine::Error> RequestTextureAsync(const TextureProperties& properties);
+
+        std::expected<ResourceHandle*, engine::Error> RequestFontAsync(const FontProperties& properties);
 
-        std::optional<engine::Error> AppendToLog(ResourceID id, const std::vector<std::string>& messages);
+        std::expected<ResourceHandle*, engine::Error> RequestJSONAsync(ResourceID id, std::string_view path);
 
-        std::optional<engine::Error> AppendToLog(engine::Log* log, const std::vector<std::string>& messages);
+        // Main thread only: turn decoded resources into Textures, Fonts and JSONDocuments (uploading textures to the
+        // GPU) until budget has passed, finishing at least one if any are waiting. Returns the number finished.
+        std::size_t FinishLoads(sf::Time budget);
+
+        // True while any requested resource is still Loading
+        [[nodiscard]] bool HasPendingLoads() const;
 
         std::expected<sf::Texture*, engine::Error> CreateSplicedTexture(
             ResourceID id, const std::vector<ResourceID>& inputTextureIDs);
@@ -80,21 +119,98 @@ namespace farcical {
             const std::vector<ResourceID>& edgeTextureIDs,
             ResourceID centerTextureID);
 
-    private:
-        void RepeatTexture(sf::Texture& input, sf::Texture& output);
-
-        void RepeatSliceHorizontal(sf::Texture& input, sf::Texture& output);
+        // Content hash of a loose or packed file, or nullopt if it can't be read. Only hashed again once the file's
+        // size or modification time changes.
+        std::optional<std::uint64_t> HashSourceFile(const std::string& path);
 
-        void RepeatSliceVertical(sf::Texture& input, sf::Texture& output);
+    private:
+        // The result of a worker thread's read & decode, waiting for the main thread to finish it
+        struct DecodedResource {
+            ResourceID id;
+            ResourceHandle::Type type;
+            sf::IntRect area;
+            // A packed Font is handed over as a view of the mapped AssetPack; a loose one as the bytes read from disk
+            std::variant<std::monostate, sf::Image, std::vector<std::byte>, std::span<const std::byte>,
+                         nlohmann::json> payload;
+            std::optional<engine::Error> failure;
+        };
+
+        std::expected<ResourceHandle*, engine::Error> BeginAsyncLoad(ResourceID id,
+                                                                     ResourceHandle::Type type,
+                                                                     std::string_view path,
+                                                                     bool& isStarted);
+
+        // Worker thread: hand a decoded resource back to the main thread
+        void PushDecoded(DecodedResource decodedResource);
+
+        // Where a Texture's pixels came from, so a composite drawn from it can be found in compositeCache
+        struct TextureSource {
+            // Loaded from (part of) a file
+            std::string path;
+            sf::IntRect area;
+            // Drawn by a Create*Texture function instead: its compositeCache key, or nullopt if it can't have one
+            bool isComposite;
+            std::optional<std::uint64_t> compositeKey;
+        };
+
+        // Content hashes of source files, only hashed again once their size or modification time changes
+        struct SourceFileHash {
+            std::uintmax_t size;
+            std::filesystem::file_time_type modifiedTime;
+            std::uint64_t hash;
+        };
+
+        std::optional<engine::Error> FinishLoad(DecodedResource& decodedResource);
+
+        // Block until the resource with this id has been decoded, then finish it
+        std::optional<engine::Error> WaitForLoad(ResourceID id);
+
+        // Load from the mounted AssetPack if path is packed, from disk if not; they throw just like SFML's own
+        // constructors if neither works
+        sf::Texture OpenTexture(const std::string& path, const sf::IntRect& area = {}) const;
+
+        sf::Font OpenFont(const std::string& path) const;
+
+        sf::Music OpenMusic(const std::string& path) const;
+
+        // Identifies the pixels of the Texture with this id, or nullopt if it's unknown where they came from
+        std::optional<std::uint64_t> GetTextureSourceKey(ResourceID id);
+
+        // The compositeCache key for a composite drawn from inputIDs by the generator & parameters described
+        std::optional<std::uint64_t> GetCompositeKey(std::string_view description,
+                                                     const std::vector<ResourceID>& inputIDs);
+
+        // Upload the composite cached under key as the Texture id, or return nullptr so the caller draws it
+        sf::Texture* ReadComposite(ResourceID id, std::optional<std::uint64_t> key);
+
+        // Remember how the Texture id was drawn & keep a copy of compositor's pixels in compositeCache
+        void WriteComposite(ResourceID id, std::optional<std::uint64_t> key, const Compositor& compositor);
+
+        // Declared before everything opened from it, so the mapping outlives the Fonts & Music streaming from it
+        AssetPack assetPack;
+        bool looseAssetsOverridePack;
 
         std::unordered_map<ResourceID, ResourceHandle> registry;
-        std::unordered_map<ResourceID, engine::Log> logs;
         std::unordered_map<ResourceID, nlohmann::json> jsonDocs;
         std::unordered_map<ResourceID, sf::Font> fonts;
         std::unordered_map<ResourceID, sf::Texture> textures;
         std::unordered_map<ResourceID, sf::Music> musics;
+        // Fonts opened from memory read from it for as long as they exist
+        std::unordered_map<ResourceID, std::vector<std::byte>> fontData;
+
+        CompositeCache compositeCache;
+        std::unordered_map<ResourceID, TextureSource> textureSources;
+        std::unordered_map<std::string, SourceFileHash> sourceFileHashes;
 
         engine::LogSystem* logSystem;
+
+        std::mutex decodedMutex;
+        std::condition_variable decodedCondition;
+        std::deque<DecodedResource> decoded;
+        // Main thread only
+        std::size_t numLoadsInFlight;
+        // Declared last so its threads are joined before anything they report to is destroyed
+        ResourceLoader loader;
     };
 }
 
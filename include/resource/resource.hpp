@@ -19,6 +19,8 @@ namespace farcical {
     struct ResourceHandle {
         enum class Status {
             Uninitialized,
+            // Being read & decoded on a ResourceLoader thread; ResourceManager::FinishLoads marks it IsReady or Error
+            Loading,
             IsReady,
             Error
         };
@@ -11,6 +11,10 @@
 #include "../engine/keyboard.hpp"
 #include "../engine/mouse.hpp"
 
+namespace farcical::engine {
+    class RenderSystem;
+}
+
 namespace farcical::ui {
     class Button final : public Widget {
     public:
@@ -52,6 +56,7 @@ namespace farcical::ui {
         explicit Button(engine::EntityID id,
                         const engine::Event::Parameters& onPress,
                         engine::EventSystem& eventSystem,
+                        engine::RenderSystem& renderSystem,
                         Container* parent);
 
         ~Button() override = default;
@@ -121,6 +126,7 @@ namespace farcical::ui {
         Status status;
         engine::Event::Parameters onPressEvent;
         std::unique_ptr<Button::Controller> controller;
+        engine::RenderSystem& renderSystem;
     };
 }
 
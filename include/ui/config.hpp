@@ -122,6 +122,9 @@ namespace farcical::ui {
     std::expected<WidgetProperties, engine::Error> LoadRadioButton(const nlohmann::json& json,
                                                                    engine::EntityID parentID);
 
+    // Everything LoadMenu reads except the buttons, radioButtons & submenus themselves
+    std::expected<MenuProperties, engine::Error> LoadMenuHeader(const nlohmann::json& json, engine::EntityID parentID);
+
     std::expected<MenuProperties, engine::Error> LoadMenu(const nlohmann::json& json, engine::EntityID parentID);
 
     std::expected<LayoutLayerProperties, engine::Error> LoadLayoutLayer(const nlohmann::json& json,
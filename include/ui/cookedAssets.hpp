@@ -0,0 +1,67 @@
+//
+// Created by dgmuller on 9/16/25.
+//
+
+#ifndef COOKED_ASSETS_HPP
+#define COOKED_ASSETS_HPP
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <SFML/System/Vector2.hpp>
+#include "config.hpp"
+#include "../engine/id.hpp"
+#include "../resource/manager.hpp"
+
+namespace farcical::ui {
+    // Where farcical_cook (tools/cook.cpp) leaves what it has prepared ahead of time, and where SceneManager looks for
+    // it. Each composite texture is named for a hash of everything that decides its pixels (input paths, contents &
+    // rects, output size, opacity), so a scene document or input image that changes a composite simply stops finding
+    // the stale copy and draws it again. Inputs are hashed with ResourceManager::HashSourceFile, which only reads a
+    // file again once its size or modification time changes.
+    //
+    // Directory layout: textures/<id>-<hash>.png, scenes/ (a SceneCache) and manifests/<sceneID>.json.
+    class CookedAssets {
+    public:
+        // An empty directory disables cooked assets
+        explicit CookedAssets(std::string_view directory = "");
+
+        [[nodiscard]] bool IsEnabled() const;
+
+        // resourceManager hashes the inputs' contents
+        [[nodiscard]] std::string GetTexturePath(ResourceManager& resourceManager,
+                                                 const RepeatingTextureProperties& properties) const;
+
+        [[nodiscard]] std::string GetTexturePath(ResourceManager& resourceManager,
+                                                 const SegmentedTextureProperties& properties) const;
+
+        // An Overlay's inputs are other textures in the same Scene, looked up in sceneProperties
+        [[nodiscard]] std::string GetTexturePath(ResourceManager& resourceManager,
+                                                 const OverlayTextureProperties& properties,
+                                                 const SceneProperties& sceneProperties) const;
+
+        // The files an Overlay's base & overlay textures are drawn from, looked up the same way
+        [[nodiscard]] std::vector<std::string> GetInputPaths(const OverlayTextureProperties& properties,
+                                                             const SceneProperties& sceneProperties) const;
+
+        // A Border is drawn to fit the window, so each window size gets its own
+        [[nodiscard]] std::string GetTexturePath(ResourceManager& resourceManager,
+                                                 const BorderTextureProperties& properties,
+                                                 const sf::Vector2u& outputSize) const;
+
+        [[nodiscard]] std::string GetSceneCachePath() const;
+
+        [[nodiscard]] std::string GetManifestPath(const engine::EntityID& sceneID) const;
+
+    private:
+        [[nodiscard]] std::string GetTexturePath(const ResourceID& id, std::string_view description) const;
+
+        std::filesystem::path directory;
+    };
+
+    // The size a BorderTexture is drawn at in a window of windowSize
+    sf::Vector2u GetBorderTextureSize(const BorderTextureProperties& properties, const sf::Vector2u& windowSize);
+}
+
+#endif //COOKED_ASSETS_HPP
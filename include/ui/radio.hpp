@@ -12,6 +12,10 @@
 #include "../engine/mouse.hpp"
 #include "../engine/system/event.hpp"
 
+namespace farcical::engine {
+    class RenderSystem;
+}
+
 namespace farcical::ui {
     class RadioButton final : public Widget, public Focusable {
     public:
@@ -50,7 +54,10 @@ namespace farcical::ui {
             engine::EventSystem& eventSystem;
         };
 
-        explicit RadioButton(engine::EntityID id, engine::EventSystem& eventSystem, Container* parent);
+        explicit RadioButton(engine::EntityID id,
+                             engine::EventSystem& eventSystem,
+                             engine::RenderSystem& renderSystem,
+                             Container* parent);
 
         ~RadioButton() override = default;
 
@@ -120,6 +127,7 @@ namespace farcical::ui {
         sf::Texture* textures[static_cast<int>(Status::NumStates)];
         Status status;
         std::unique_ptr<RadioButton::Controller> controller;
+        engine::RenderSystem& renderSystem;
     };
 }
 
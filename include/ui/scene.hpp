@@ -10,6 +10,7 @@
 #include "container.hpp"
 #include "../resource/manager.hpp"
 #include "../engine/event.hpp"
+#include "../engine/component/render.hpp"
 
 namespace farcical::ui {
     class Scene final : public Container, public engine::EventHandler {
@@ -44,6 +45,9 @@ namespace farcical::ui {
 
         [[nodiscard]] TextureProperties GetCachedTextureProperties(ResourceID id) const;
 
+        // The slices of a Border drawn as a NineSlice instead of a baked Texture, if that's how id is drawn
+        [[nodiscard]] std::optional<engine::NineSlice> GetCachedNineSlice(ResourceID id) const;
+
         void CacheMusic(ResourceID id, sf::Music* music);
 
         void CacheMusicProperties(ResourceID id, const MusicProperties& musicProperties);
@@ -56,6 +60,8 @@ namespace farcical::ui {
 
         void CacheTextureProperties(ResourceID id, const TextureProperties& textureProperties);
 
+        void CacheNineSlice(ResourceID id, const engine::NineSlice& nineSlice);
+
         void ClearMusicCache();
 
         void ClearMusicPropertiesCache();
@@ -68,6 +74,8 @@ namespace farcical::ui {
 
         void ClearTexturePropertiesCache();
 
+        void ClearNineSliceCache();
+
         /*
         [[nodiscard]] std::expected<MenuController*, engine::Error> CreateMenuController(
             Menu* menu, engine::EventSystem& eventSystem);
@@ -88,6 +96,7 @@ namespace farcical::ui {
 
         std::unordered_map<ResourceID, sf::Texture*> textureCache;
         std::unordered_map<ResourceID, TextureProperties> texturePropertiesCache;
+        std::unordered_map<ResourceID, engine::NineSlice> nineSliceCache;
 
         //std::unordered_map<engine::EntityID, std::unique_ptr<MenuController> > menuControllers;
     };
@@ -0,0 +1,62 @@
+//
+// Created by dgmuller on 9/13/25.
+//
+
+#ifndef SCENE_CACHE_HPP
+#define SCENE_CACHE_HPP
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include "config.hpp"
+#include "../engine/error.hpp"
+
+namespace farcical::ui {
+    // Keeps a compact binary copy of each scene document's SceneProperties, so a warm start loads a Scene with one
+    // read and no JSON parsing. Entries are keyed by the document's path and checked against its size, modification
+    // time and content hash; a stale or unreadable entry is reported as an error so the caller can parse the document
+    // and Write a fresh one. Read & Write touch nothing but their own files, so they're safe to call from any thread.
+    //
+    // File layout: a Header, the document's path, then the SceneProperties.
+    class SceneCache {
+    public:
+        static constexpr char Magic[8] = {'F', 'A', 'R', 'C', 'S', 'C', 'N', 'E'};
+        // Bump whenever SceneProperties (or anything inside it) changes shape
+        static constexpr std::uint32_t Version = 3;
+
+        struct Header {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t pathLength;
+            std::uint64_t sourceSize;
+            std::int64_t sourceModifiedTime;
+            std::uint64_t sourceHash;
+            // Checked before anything is decoded, so a corrupt entry never interns a garbage EntityID
+            std::uint64_t propertiesHash;
+        };
+
+        // An empty directory disables the cache
+        explicit SceneCache(std::string_view directory = "");
+
+        [[nodiscard]] bool IsEnabled() const;
+
+        std::expected<SceneProperties, engine::Error> Read(std::string_view sourcePath) const;
+
+        std::optional<engine::Error> Write(std::string_view sourcePath, const SceneProperties& properties) const;
+
+        // Whether there is an entry for sourcePath at all, without checking that it's fresh
+        [[nodiscard]] bool Contains(std::string_view sourcePath) const;
+
+        // 64-bit FNV-1a
+        static std::uint64_t HashBytes(std::string_view bytes);
+
+    private:
+        [[nodiscard]] std::filesystem::path GetEntryPath(std::string_view sourcePath) const;
+
+        std::filesystem::path directory;
+    };
+}
+
+#endif //SCENE_CACHE_HPP
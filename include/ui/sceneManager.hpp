@@ -4,9 +4,13 @@
 #ifndef SCENE_MANAGER_HPP
 #define SCENE_MANAGER_HPP
 
+#include <list>
 #include <memory>
+#include <unordered_set>
 #include "config.hpp"
+#include "cookedAssets.hpp"
 #include "scene.hpp"
+#include "sceneCache.hpp"
 #include "../engine/logInterface.hpp"
 
 namespace farcical::engine {
@@ -30,11 +34,15 @@ namespace farcical::ui {
 
         SceneManager& operator=(SceneManager&&) = delete;
 
+        // Read the scene-ID-to-document mapping. Scene documents themselves are only parsed here if the engine
+        // config turns loadScenesOnDemand off.
         std::optional<engine::Error> LoadResourceIndex(std::string_view indexPath);
 
-        [[nodiscard]] std::expected<SceneProperties, engine::Error> GetCurrentSceneProperties() const;
+        [[nodiscard]] std::expected<SceneProperties, engine::Error> GetCurrentSceneProperties();
 
-        [[nodiscard]] std::expected<SceneProperties, engine::Error> FindSceneProperties(engine::EntityID id) const;
+        // Parses the Scene's document the first time it's asked for, evicting the least recently used SceneProperties
+        // if that makes too many
+        [[nodiscard]] std::expected<SceneProperties, engine::Error> FindSceneProperties(engine::EntityID id);
 
         [[nodiscard]] Scene* GetCurrentScene() const;
 
@@ -42,11 +50,45 @@ namespace farcical::ui {
 
         std::optional<engine::Error> DestroyCurrentScene();
 
+        // Start reading & decoding the Scene's fonts and textures, and switch to it from Update once none of them are
+        // still Loading. The current Scene stays on screen (and in use) until then; a later request replaces this one.
+        std::optional<engine::Error> RequestScene(engine::EntityID id);
+
+        // Called once per frame: replaces the current Scene with the requested one if it's ready, so neither
+        // DestroyCurrentScene nor SetCurrentScene ever waits for a decode
+        std::optional<engine::Error> Update();
+
+        [[nodiscard]] bool IsScenePending() const;
+
         static constexpr std::string_view MainMenuSceneID{"mainMenuScene"};
 
     private:
+        // Documents missing from sceneCache are streamed into SceneProperties (see ReadScene) on JobSystem workers;
+        // the first failure in SceneIndex order is the one reported, however the work was scheduled. Packed documents
+        // are always streamed straight from the AssetPack; sceneCache only keeps copies of loose ones.
         std::optional<engine::Error> BuildPropertiesCache();
 
+        // Read a single Scene from sceneCache, or else stream its document from disk (or parse the one preloaded for
+        // it, then release it) and refresh the cache
+        std::expected<SceneProperties, engine::Error> LoadSceneProperties(engine::EntityID id);
+
+        // Stream a scene document from the mounted AssetPack if it's packed, or else from disk
+        std::expected<SceneProperties, engine::Error> ReadSceneDocument(const std::string& documentPath) const;
+
+        // Insert into propertiesCache as the most recently used, and trim it to maxCachedScenes
+        const SceneProperties& CacheSceneProperties(engine::EntityID id, SceneProperties properties);
+
+        // Start reading the documents of Scenes that properties' buttons create, and release any preloaded earlier
+        // that are no longer linked
+        std::optional<engine::Error> PreloadLinkedScenes(const SceneProperties& properties);
+
+        // Start reading & decoding the scene's fonts and textures on ResourceLoader threads, so the Build*Cache
+        // functions below only wait for whatever hasn't finished yet
+        std::optional<engine::Error> RequestResources(const SceneProperties& properties) const;
+
+        // Destroy whatever the pending Scene requested that neither the newly requested Scene nor currentScene uses
+        std::optional<engine::Error> ReleasePendingResources(const SceneProperties& nextProperties);
+
         std::optional<engine::Error> BuildResourceCache(const SceneProperties& properties) const;
 
         std::optional<engine::Error> DestroyResourceCache(const SceneProperties& properties) const;
@@ -76,7 +118,7 @@ namespace farcical::ui {
             const std::vector<SegmentedTextureProperties>& textures) const;
 
         std::optional<engine::Error> BuildOverlayTextureCache(
-            const std::vector<OverlayTextureProperties>& textures) const;
+            const std::vector<OverlayTextureProperties>& textures, const SceneProperties& sceneProperties) const;
 
         std::optional<engine::Error> DestroyOverlayTextureCache(
             const std::vector<OverlayTextureProperties>& textures) const;
@@ -85,12 +127,33 @@ namespace farcical::ui {
 
         std::optional<engine::Error> DestroyBorderTextureCache(const BorderTextureProperties& properties) const;
 
+        // Load the composite texture farcical_cook left at cookedPath as id, or return nullptr if there isn't one (or
+        // it can't be loaded) so the caller draws it instead
+        sf::Texture* LoadCookedTexture(const ResourceID& id, const std::string& cookedPath) const;
+
         engine::Engine& engine;
         ResourceManager& resourceManager;
 
         std::unique_ptr<Scene> currentScene;
-        std::unordered_map<engine::EntityID, SceneProperties> propertiesCache;
+        struct CachedScene {
+            SceneProperties properties;
+            std::list<engine::EntityID>::iterator lruPosition;
+        };
+
+        std::unordered_map<engine::EntityID, CachedScene> propertiesCache;
+        // Most recently used first
+        std::list<engine::EntityID> propertiesLRU;
+        // Scenes whose documents were requested ahead of time and haven't been parsed yet
+        std::unordered_set<engine::EntityID> preloadedScenes;
+        SceneCache sceneCache;
+        CookedAssets cookedAssets;
         std::unordered_map<engine::EntityID, ResourceParameters> resourceIndex;
+        // Scene IDs in the order they appear in SceneIndex
+        std::vector<engine::EntityID> resourceIndexOrder;
+        // Scene to switch to once the Fonts & Textures it requested are no longer Loading; each is mapped to its
+        // persist flag. DestroyCurrentScene keeps any of them the current Scene shares instead of reloading them.
+        std::optional<engine::EntityID> pendingSceneID;
+        std::unordered_map<ResourceID, bool> pendingResources;
 
         static constexpr std::string_view sceneIndexDocumentID = "sceneIndex";
     };
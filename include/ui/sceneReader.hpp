@@ -0,0 +1,27 @@
+//
+// Created by dgmuller on 9/14/25.
+//
+
+#ifndef SCENE_READER_HPP
+#define SCENE_READER_HPP
+
+#include <expected>
+#include <string_view>
+#include "config.hpp"
+#include "../engine/error.hpp"
+
+namespace farcical::ui {
+    // Fills SceneProperties straight from a scene document's text, through nlohmann's SAX interface, instead of
+    // parsing the whole document into a DOM and walking it with LoadScene. Only the element being read (one texture,
+    // Decoration, Button...) is ever built as JSON; it's handed to the same Load* function LoadScene would use and
+    // dropped. Menus, layers & the lists that hold them are never built at all, so peak memory is the SceneProperties
+    // plus the largest single element, however big the document gets.
+    //
+    // A document is checked the same way LoadScene checks it, but errors are reported in document order.
+    std::expected<SceneProperties, engine::Error> ReadScene(std::string_view document);
+
+    // Maps the file at path and reads it with ReadScene
+    std::expected<SceneProperties, engine::Error> ReadSceneFile(std::string_view path);
+}
+
+#endif //SCENE_READER_HPP
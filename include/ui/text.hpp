@@ -13,11 +13,16 @@
 #include "container.hpp"
 #include "../resource/config.hpp"
 #include "../engine/error.hpp"
+#include "../engine/component/render.hpp"
+
+namespace farcical::engine {
+  class RenderSystem;
+}
 
 namespace farcical::ui {
   class Text final : public Widget {
   public:
-    explicit Text(engine::EntityID id, Container* parent = nullptr);
+    explicit Text(engine::EntityID id, engine::RenderSystem& renderSystem, Container* parent = nullptr);
 
     ~Text() override = default;
 
@@ -39,6 +44,10 @@ namespace farcical::ui {
     void DoAction(Action action) override;
 
   private:
+    // Text components own a retained sf::Text in their RenderComponent, so property changes are forwarded there
+    engine::RenderComponent* GetRenderComponent() const;
+
+    engine::RenderSystem& renderSystem;
     sf::Font*       font;
     FontProperties  fontProperties;
     std::string     contents;
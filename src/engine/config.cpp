@@ -3,7 +3,9 @@
 //
 #include <fstream>
 #include "../../include/engine/config.hpp"
+#include "../../include/resource/compositeCache.hpp"
 #include "../../include/resource/parser.hpp"
+#include "../../include/engine/logWriter.hpp"
 
 std::expected<farcical::engine::Config, farcical::engine::Error> farcical::engine::LoadConfig(
     const nlohmann::json& json,
@@ -19,7 +21,21 @@ std::expected<farcical::engine::Config, farcical::engine::Error> farcical::engin
             .detectNativeResolution = false,
         },
         .scenePath = {},
-        .logPath = {}
+        .logPath = {},
+        .tickRate = Config::DefaultTickRate,
+        .maxTicksPerFrame = Config::DefaultMaxTicksPerFrame,
+        .maxLogSize = LogRotation::DefaultMaxFileSize,
+        .maxLogFiles = LogRotation::DefaultMaxNumFiles,
+        .flightRecorderSize = 0,
+        .loadScenesOnDemand = true,
+        .maxCachedScenes = Config::DefaultMaxCachedScenes,
+        .preloadLinkedScenes = true,
+        .sceneCachePath = std::string{Config::DefaultSceneCachePath},
+        .assetPackPath = {},
+        .looseAssetsOverridePack = Config::DefaultLooseAssetsOverridePack,
+        .cookedAssetPath = {},
+        .compositeCachePath = std::string{Config::DefaultCompositeCachePath},
+        .maxCompositeCacheSize = CompositeCache::DefaultMaxSize
     };
     const auto& findScenePath{json.find("scenePath")};
     if(findScenePath != json.end()) {
@@ -31,6 +47,95 @@ std::expected<farcical::engine::Config, farcical::engine::Error> farcical::engin
         config.logPath = findLogPath.value().get<std::string>();
     } // if logPath found
 
+    const auto& findTickRate{json.find("tickRate")};
+    if(findTickRate != json.end()) {
+        config.tickRate = findTickRate.value().get<int>();
+        if(config.tickRate <= 0) {
+            const std::string valueName{"tickRate"};
+            return std::unexpected{
+                errorGenerator->GenerateError(Error::Signal::UnexpectedValue,
+                                              std::vector<std::any>{valueName, std::to_string(config.tickRate)})};
+        } // if tickRate <= 0
+    } // if tickRate found
+
+    const auto& findMaxTicks{json.find("maxTicksPerFrame")};
+    if(findMaxTicks != json.end()) {
+        config.maxTicksPerFrame = findMaxTicks.value().get<int>();
+        if(config.maxTicksPerFrame <= 0) {
+            const std::string valueName{"maxTicksPerFrame"};
+            return std::unexpected{
+                errorGenerator->GenerateError(Error::Signal::UnexpectedValue,
+                                              std::vector<std::any>{valueName, std::to_string(config.maxTicksPerFrame)})};
+        } // if maxTicksPerFrame <= 0
+    } // if maxTicksPerFrame found
+
+    const auto& findMaxLogSize{json.find("maxLogSize")};
+    if(findMaxLogSize != json.end()) {
+        config.maxLogSize = findMaxLogSize.value().get<std::uintmax_t>();
+    } // if maxLogSize found
+
+    const auto& findMaxLogFiles{json.find("maxLogFiles")};
+    if(findMaxLogFiles != json.end()) {
+        const int maxLogFiles{findMaxLogFiles.value().get<int>()};
+        if(maxLogFiles <= 0) {
+            const std::string valueName{"maxLogFiles"};
+            return std::unexpected{
+                errorGenerator->GenerateError(Error::Signal::UnexpectedValue,
+                                              std::vector<std::any>{valueName, std::to_string(maxLogFiles)})};
+        } // if maxLogFiles <= 0
+        config.maxLogFiles = static_cast<std::size_t>(maxLogFiles);
+    } // if maxLogFiles found
+
+    const auto& findFlightRecorderSize{json.find("flightRecorderSize")};
+    if(findFlightRecorderSize != json.end()) {
+        config.flightRecorderSize = findFlightRecorderSize.value().get<std::uint32_t>();
+    } // if flightRecorderSize found
+
+    const auto& findLoadScenesOnDemand{json.find("loadScenesOnDemand")};
+    if(findLoadScenesOnDemand != json.end()) {
+        config.loadScenesOnDemand = findLoadScenesOnDemand.value().get<bool>();
+    } // if loadScenesOnDemand found
+
+    const auto& findMaxCachedScenes{json.find("maxCachedScenes")};
+    if(findMaxCachedScenes != json.end()) {
+        config.maxCachedScenes = findMaxCachedScenes.value().get<std::size_t>();
+    } // if maxCachedScenes found
+
+    const auto& findPreloadLinkedScenes{json.find("preloadLinkedScenes")};
+    if(findPreloadLinkedScenes != json.end()) {
+        config.preloadLinkedScenes = findPreloadLinkedScenes.value().get<bool>();
+    } // if preloadLinkedScenes found
+
+    const auto& findSceneCachePath{json.find("sceneCachePath")};
+    if(findSceneCachePath != json.end()) {
+        config.sceneCachePath = findSceneCachePath.value().get<std::string>();
+    } // if sceneCachePath found
+
+    const auto& findAssetPackPath{json.find("assetPackPath")};
+    if(findAssetPackPath != json.end()) {
+        config.assetPackPath = findAssetPackPath.value().get<std::string>();
+    } // if assetPackPath found
+
+    const auto& findLooseAssetsOverridePack{json.find("looseAssetsOverridePack")};
+    if(findLooseAssetsOverridePack != json.end()) {
+        config.looseAssetsOverridePack = findLooseAssetsOverridePack.value().get<bool>();
+    } // if looseAssetsOverridePack found
+
+    const auto& findCookedAssetPath{json.find("cookedAssetPath")};
+    if(findCookedAssetPath != json.end()) {
+        config.cookedAssetPath = findCookedAssetPath.value().get<std::string>();
+    } // if cookedAssetPath found
+
+    const auto& findCompositeCachePath{json.find("compositeCachePath")};
+    if(findCompositeCachePath != json.end()) {
+        config.compositeCachePath = findCompositeCachePath.value().get<std::string>();
+    } // if compositeCachePath found
+
+    const auto& findMaxCompositeCacheSize{json.find("maxCompositeCacheSize")};
+    if(findMaxCompositeCacheSize != json.end()) {
+        config.maxCompositeCacheSize = findMaxCompositeCacheSize.value().get<std::uintmax_t>();
+    } // if maxCompositeCacheSize found
+
     const auto& findWindow{json.find("window")};
     if(findWindow == json.end()) {
         const std::string errorDetails{
@@ -91,10 +196,24 @@ std::optional<farcical::engine::Error> farcical::engine::WriteConfig(const Confi
                         {"y", config.windowProperties.position.y}
                     }
                 }
-            },
-            {"scenePath", config.scenePath},
-            {"logPath", config.logPath}
-        }
+            }
+        },
+        {"scenePath", config.scenePath},
+        {"logPath", config.logPath},
+        {"tickRate", config.tickRate},
+        {"maxTicksPerFrame", config.maxTicksPerFrame},
+        {"maxLogSize", config.maxLogSize},
+        {"maxLogFiles", config.maxLogFiles},
+        {"flightRecorderSize", config.flightRecorderSize},
+        {"loadScenesOnDemand", config.loadScenesOnDemand},
+        {"maxCachedScenes", config.maxCachedScenes},
+        {"preloadLinkedScenes", config.preloadLinkedScenes},
+        {"sceneCachePath", config.sceneCachePath},
+        {"assetPackPath", config.assetPackPath},
+        {"looseAssetsOverridePack", config.looseAssetsOverridePack},
+        {"cookedAssetPath", config.cookedAssetPath},
+        {"compositeCachePath", config.compositeCachePath},
+        {"maxCompositeCacheSize", config.maxCompositeCacheSize}
     };
     std::ofstream output{std::string{path}, std::ios_base::out};
     output << configJSON << std::endl;
@@ -4,6 +4,7 @@
 
 #include "../../include/engine/engine.hpp"
 #include "../../include/game/game.hpp"
+#include <algorithm>
 #include <cassert>
 
 farcical::engine::Engine::Engine(std::string_view configPath) : status{Status::Uninitialized},
@@ -13,10 +14,14 @@ farcical::engine::Engine::Engine(std::string_view configPath) : status{Status::U
                                                                 sceneManager{nullptr},
                                                                 eventSystem{nullptr},
                                                                 inputSystem{nullptr},
+                                                                jobSystem{nullptr},
                                                                 logSystem{nullptr},
                                                                 musicSystem{nullptr},
                                                                 renderSystem{nullptr},
-                                                                game{nullptr} {
+                                                                game{nullptr},
+                                                                idleTime{sf::Time::Zero},
+                                                                numFramesSaved{0},
+                                                                tickAccumulator{sf::Time::Zero} {
 }
 
 farcical::engine::Engine::Status farcical::engine::Engine::GetStatus() const {
@@ -86,6 +91,14 @@ std::optional<farcical::engine::Error> farcical::engine::Engine::ApplyConfig(con
 
   errorHandler.SetLogSystemPtr(logSystem.get());
 
+  if(!config.assetPackPath.empty()) {
+    const auto& mountAssetPack{resourceManager.MountAssetPack(config.assetPackPath, config.looseAssetsOverridePack)};
+    if(mountAssetPack.has_value()) {
+      return mountAssetPack.value();
+    } // if mountAssetPack == failure
+  } // if an AssetPack is configured
+  resourceManager.SetCompositeCache(config.compositeCachePath, config.maxCompositeCacheSize);
+
   const auto& createWindowResult{CreateWindow()};
   if(createWindowResult.has_value()) {
     return createWindowResult.value();
@@ -114,9 +127,13 @@ std::optional<farcical::engine::Error> farcical::engine::Engine::ApplyConfig(con
     return initFirstScene.error();
   } // if initFirstScene == failure
 
+  // Time spent loading is not simulated
+  frameClock.restart();
+  tickAccumulator = sf::Time::Zero;
+
   status = Status::IsRunning;
-  logSystem->AddMessage("Engine initialization completed successfully.");
-  logSystem->AddMessage("");
+  const LogInterface log{*logSystem, "Engine"};
+  log.LogInfo("Engine initialization completed successfully.");
 
   return std::nullopt;
 }
@@ -140,6 +157,7 @@ std::optional<farcical::engine::Error> farcical::engine::Engine::Init(game::Game
 }
 
 void farcical::engine::Engine::Update() {
+  FARCICAL_PROFILE_FRAME();
   game::Game::Status gameStatus{game->GetStatus()};
   if(gameStatus == game::Game::Status::StoppedSuccessfully) {
     Stop();
@@ -150,30 +168,138 @@ void farcical::engine::Engine::Update() {
     status = Status::Error;
     return;
   } // Game Error || Uninitialized
-  while(const std::optional event = window->pollEvent()) {
-    if(event->is<sf::Event::Closed>()) {
-      Stop();
+  if(status == Status::IsRunning && IsIdle()) {
+    // Block until input arrives rather than redrawing an unchanged screen. Only a Game with something to simulate
+    // wakes it in time for the next simulation tick, so that idling never changes how often that game is updated.
+    const bool isSimulating{game->IsSimulating()};
+    sf::Time timeout{sf::milliseconds(idleTimeoutMS)};
+    if(isSimulating) {
+      const sf::Time untilNextTick{GetTickLength() - tickAccumulator - frameClock.getElapsedTime()};
+      timeout = std::min(timeout, untilNextTick);
+    } // if isSimulating
+    FARCICAL_PROFILE_SCOPE("Engine::WaitEvent");
+    const sf::Clock idleClock;
+    const std::optional event{window->waitEvent(std::max(timeout, sf::microseconds(1)))};
+    idleTime += idleClock.getElapsedTime();
+    if(!isSimulating) {
+      // Nothing was simulated while the engine waited, so RunSimulationTicks mustn't try to catch up on it
+      frameClock.restart();
+      tickAccumulator = sf::Time::Zero;
+    } // if !isSimulating
+    if(event.has_value() && !HandleWindowEvent(*event)) {
       return;
-    }
-  }
+    } // if event closed the window
+  } // if IsIdle()
+  if(!PumpEvents()) {
+    return;
+  } // if window was closed
   if(status == Status::IsRunning) {
+    if(resourceManager.HasPendingLoads()) {
+      resourceManager.FinishLoads(sf::milliseconds(resourceUploadBudgetMS));
+    } // if resources are loading
+    const auto& updateScene{sceneManager->Update()};
+    if(updateScene.has_value()) {
+      const LogInterface log{*logSystem, "Engine"};
+      log.LogError("{}", updateScene.value().message);
+      status = Status::Error;
+      Stop();
+      return;
+    } // if updateScene == failure
     logSystem->Update();
-    renderSystem->Update();
     inputSystem->Update();
     eventSystem->Update();
     musicSystem->Update();
-    const auto& gameUpdateResult{game->Update()};
-    if(gameUpdateResult.has_value()) {
+    if(!RunSimulationTicks()) {
       status = Status::Error;
       Stop();
     }
+    if(status == Status::IsRunning && renderSystem) {
+      renderSystem->SetInterpolationAlpha(tickAccumulator / GetTickLength());
+      if(renderSystem->IsDirty()) {
+        renderSystem->Update();
+      } // if renderSystem->IsDirty()
+      else {
+        ++numFramesSaved;
+      } // else nothing on screen changed
+    } // if still running
     if(!window->isOpen()) {
       status = Status::StoppedSuccessfully;
     }
   }
 }
 
+bool farcical::engine::Engine::IsIdle() const {
+  return !renderSystem->IsDirty()
+         && eventSystem->IsQueueEmpty()
+         && !resourceManager.HasPendingLoads()
+         && !sceneManager->IsScenePending()
+         && !musicSystem->IsTransitionPending();
+}
+
+sf::Time farcical::engine::Engine::GetTickLength() const {
+  return sf::seconds(1.0f / static_cast<float>(config.tickRate));
+}
+
+bool farcical::engine::Engine::RunSimulationTicks() {
+  FARCICAL_PROFILE_SCOPE("Engine::RunSimulationTicks");
+  const sf::Time tickLength{GetTickLength()};
+  const sf::Time maxAccumulated{tickLength * static_cast<std::int64_t>(config.maxTicksPerFrame)};
+  tickAccumulator += frameClock.restart();
+  if(tickAccumulator > maxAccumulated) {
+    // Too far behind to catch up (the "spiral of death"), so let the simulation run slower than real time instead
+    tickAccumulator = maxAccumulated;
+  } // if tickAccumulator > maxAccumulated
+  while(tickAccumulator >= tickLength) {
+    const auto& gameUpdateResult{game->Update()};
+    if(gameUpdateResult.has_value()) {
+      return false;
+    } // if gameUpdateResult == failure
+    tickAccumulator -= tickLength;
+  } // while a whole tick has accumulated
+  return true;
+}
+
+bool farcical::engine::Engine::HandleWindowEvent(const sf::Event& event) {
+  if(event.is<sf::Event::Closed>()) {
+    Stop();
+    return false;
+  } // if event == Closed
+  if(event.is<sf::Event::Resized>() || event.is<sf::Event::FocusGained>()) {
+    // The window's contents may have been lost, so the next frame must be drawn even if nothing changed. No listener
+    // handles either event, so they aren't buffered.
+    renderSystem->RequestRedraw();
+    return true;
+  } // if event == Resized || event == FocusGained
+#ifdef FARCICAL_ENABLE_PROFILER
+  if(const auto* keyPressed = event.getIf<sf::Event::KeyPressed>(); keyPressed && keyPressed->code == profilerTraceKey) {
+    WriteProfilerTrace();
+  } // if profilerTraceKey was pressed
+#endif
+  inputBuffer.Push(event);
+  return true;
+}
+
+bool farcical::engine::Engine::PumpEvents() {
+  FARCICAL_PROFILE_SCOPE("Engine::PumpEvents");
+  // Once the buffer is full, remaining events stay in the window's queue until next frame rather than being dropped
+  while(!inputBuffer.IsFull()) {
+    const std::optional event{window->pollEvent()};
+    if(!event.has_value()) {
+      break;
+    } // if no more events
+    if(!HandleWindowEvent(*event)) {
+      return false;
+    } // if event closed the window
+  } // while inputBuffer has room
+  return true;
+}
+
 void farcical::engine::Engine::Stop() {
+#ifdef FARCICAL_ENABLE_PROFILER
+  if(status == Status::IsRunning) {
+    WriteProfilerTrace();
+  } // if shutting down a running engine
+#endif
   game->Stop();
   if(sceneManager) {
     sceneManager->DestroyCurrentScene();
@@ -195,7 +321,16 @@ void farcical::engine::Engine::Stop() {
     renderSystem->Stop();
     renderSystem.reset(nullptr);
   } // if renderSystem
+  if(jobSystem) {
+    // Runs anything still queued, so it has to go before the systems those jobs might log to
+    jobSystem->Stop();
+    jobSystem.reset(nullptr);
+  } // if jobSystem
   if(logSystem) {
+    if(numFramesSaved > 0) {
+      const LogInterface log{*logSystem, "Engine"};
+      log.LogInfo("Engine idled for {} seconds and skipped {} unchanged frames.", idleTime.asSeconds(), numFramesSaved);
+    } // if numFramesSaved > 0
     logSystem->Stop();
     logSystem.reset(nullptr);
   } // if logSystem
@@ -234,6 +369,11 @@ farcical::engine::InputSystem& farcical::engine::Engine::GetInputSystem() const
   return *inputSystem;
 }
 
+farcical::engine::JobSystem& farcical::engine::Engine::GetJobSystem() const {
+  assert(jobSystem != nullptr && "Unexpected nullptr: jobSystem");
+  return *jobSystem;
+}
+
 farcical::engine::LogSystem& farcical::engine::Engine::GetLogSystem() const {
   assert(logSystem != nullptr && "Unexpected nullptr: logSystem");
   return *logSystem;
@@ -249,6 +389,14 @@ farcical::engine::RenderSystem& farcical::engine::Engine::GetRenderSystem() cons
   return *renderSystem;
 }
 
+sf::Time farcical::engine::Engine::GetIdleTime() const {
+  return idleTime;
+}
+
+std::uint64_t farcical::engine::Engine::GetNumFramesSaved() const {
+  return numFramesSaved;
+}
+
 std::optional<farcical::engine::Error> farcical::engine::Engine::CreateLogSystem() {
   if(config.logPath.empty()) {
     const std::string failMsg{"Error: Missing or invalid LogPath in Engine config!"};
@@ -259,7 +407,10 @@ std::optional<farcical::engine::Error> farcical::engine::Engine::CreateLogSystem
     logSystem->Stop();
     logSystem.reset();
   } // if LogSystem already exists
-  logSystem = std::make_unique<LogSystem>(std::string{engineLogID}, logPath);
+  logSystem = std::make_unique<LogSystem>(std::string{engineLogID},
+                                          logPath,
+                                          LogRotation{config.maxLogSize, config.maxLogFiles},
+                                          config.flightRecorderSize);
   return std::nullopt;
 }
 
@@ -307,7 +458,14 @@ std::optional<farcical::engine::Error> farcical::engine::Engine::CreateSystems()
     inputSystem->Stop();
     inputSystem.reset();
   } // if inputSystem already exists
-  inputSystem = std::make_unique<InputSystem>(*window, *logSystem, &errorHandler);
+  inputBuffer.Clear();
+  inputSystem = std::make_unique<InputSystem>(inputBuffer, *logSystem, &errorHandler);
+
+  if(jobSystem) {
+    jobSystem->Stop();
+    jobSystem.reset();
+  } // if jobSystem already exists
+  jobSystem = std::make_unique<JobSystem>(*logSystem, &errorHandler);
 
   if(musicSystem) {
     musicSystem->Stop();
@@ -327,7 +485,22 @@ std::optional<farcical::engine::Error> farcical::engine::Engine::CreateSystems()
 std::optional<farcical::engine::Error> farcical::engine::Engine::InitSystems() {
   eventSystem->Init();
   inputSystem->Init();
+  jobSystem->Init();
   musicSystem->Init();
   renderSystem->Init();
   return std::nullopt;
 }
+
+void farcical::engine::Engine::WriteProfilerTrace() {
+  const std::string tracePath{config.logPath + "/" + std::string{profilerTraceFileName}};
+  const auto& writeTrace{Profiler::Get().WriteTrace(tracePath)};
+  if(logSystem) {
+    const LogInterface log{*logSystem, "Engine"};
+    if(writeTrace.has_value()) {
+      log.LogWarning("{}", writeTrace.value().message);
+    } // if writeTrace == failure
+    else {
+      log.LogInfo("Profiler trace written to {}.", tracePath);
+    } // else writeTrace == success
+  } // if logSystem
+}
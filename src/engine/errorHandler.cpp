@@ -66,9 +66,11 @@ farcical::engine::ErrorHandler::GenerateError(Error::Signal signal, std::vector<
 
     errorOccurred = true;
     lastError = error;
-    const std::string logMsg{"ErrorSignal #" + std::to_string(static_cast<int>(error.signal))};
-    logSystem->WriteToLog(error.message);
-    logSystem->WriteToLog(error.context);
+    const LogInterface log{*logSystem, "ErrorHandler"};
+    log.LogError("ErrorSignal #{}: {}", static_cast<int>(error.signal), error.message);
+    log.LogError("Context: {}", error.context);
+    // Make sure the error reaches the disk even if the engine doesn't get a chance to shut down cleanly
+    logSystem->Flush();
 
     return error;
 }
@@ -0,0 +1,132 @@
+//
+// Created by dgmuller on 9/10/25.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include "../../include/engine/flightRecorder.hpp"
+
+std::optional<farcical::engine::Error> farcical::engine::FlightRecorder::Open(std::string_view path,
+                                                                              std::uint32_t capacity) {
+    std::lock_guard lock{mutex};
+    if(capacity == 0) {
+        const std::string failMsg{"Unexpected value: FlightRecorder capacity = 0."};
+        return Error{Error::Signal::UnexpectedValue, failMsg};
+    } // if capacity == 0
+    const auto& mapFile{file.Open(path, MappedFile::Mode::ReadWrite, HeaderSize + capacity)};
+    if(mapFile.has_value()) {
+        return mapFile;
+    } // if mapFile == failure
+    this->capacity = capacity;
+
+    Header* header{GetHeader()};
+    if(std::memcmp(header->magic, Magic, sizeof(Magic)) != 0
+       || header->version != Version
+       || header->capacity != capacity) {
+        // New file, or one written with a different layout: start an empty ring
+        std::memset(file.GetData(), 0, file.GetSize());
+        std::memcpy(header->magic, Magic, sizeof(Magic));
+        header->version = Version;
+        header->capacity = capacity;
+        header->writePosition = 0;
+    } // if ring must be (re)initialized
+    reservePosition.store(header->writePosition, std::memory_order_relaxed);
+    ring.store(file.GetData() + HeaderSize, std::memory_order_seq_cst);
+    return std::nullopt;
+}
+
+void farcical::engine::FlightRecorder::Close() {
+    std::lock_guard lock{mutex};
+    // New Writes now see a closed ring; the ones already copying in must finish before the mapping goes away
+    ring.store(nullptr, std::memory_order_seq_cst);
+    for(std::uint32_t current{numWriters.load()}; current > 0; current = numWriters.load()) {
+        numWriters.wait(current);
+    } // for each wait on a Write still in progress
+    file.Flush();
+    file.Close();
+    capacity = 0;
+}
+
+bool farcical::engine::FlightRecorder::IsOpen() const {
+    return file.IsOpen();
+}
+
+void farcical::engine::FlightRecorder::Write(std::string_view record) {
+    numWriters.fetch_add(1);
+    std::byte* const ringData{ring.load()};
+    if(!ringData) {
+        if(numWriters.fetch_sub(1) == 1) {
+            numWriters.notify_all();
+        } // if Close may be waiting on this Write
+        return;
+    } // if not open
+    // Leave room for the newline; the ring must still hold the whole record afterwards
+    record = record.substr(0, capacity - 1);
+    const std::uint64_t recordLength{record.size() + 1};
+    const std::uint64_t position{reservePosition.fetch_add(recordLength, std::memory_order_relaxed)};
+
+    const auto& copyToRing{
+        [this, ringData](std::uint64_t position, const char* source, std::size_t length) {
+            const std::size_t offset{static_cast<std::size_t>(position % capacity)};
+            const std::size_t firstPart{std::min<std::size_t>(length, capacity - offset)};
+            std::memcpy(ringData + offset, source, firstPart);
+            std::memcpy(ringData, source + firstPart, length - firstPart);
+        }
+    };
+    copyToRing(position, record.data(), record.size());
+    copyToRing(position + record.size(), "\n", 1);
+
+    // Publish only once every earlier reservation has been, so writePosition is the lowest fully written position.
+    // More than capacity bytes in flight at once can still overwrite a record before it's published; those are the
+    // records a wrapped ring loses anyway.
+    std::atomic_ref writePosition{GetHeader()->writePosition};
+    for(std::uint64_t current{writePosition.load(std::memory_order_acquire)}; current != position;
+        current = writePosition.load(std::memory_order_acquire)) {
+        writePosition.wait(current, std::memory_order_acquire);
+    } // for each wait on an earlier Write still copying in
+    writePosition.store(position + recordLength, std::memory_order_release);
+    writePosition.notify_all();
+    if(numWriters.fetch_sub(1) == 1) {
+        numWriters.notify_all();
+    } // if Close may be waiting on this Write
+}
+
+std::expected<std::string, farcical::engine::Error> farcical::engine::FlightRecorder::ReadRing(std::string_view path) {
+    MappedFile input;
+    const auto& mapFile{input.Open(path, MappedFile::Mode::ReadOnly)};
+    if(mapFile.has_value()) {
+        return std::unexpected(mapFile.value());
+    } // if mapFile == failure
+    Header header{};
+    if(input.GetSize() >= HeaderSize) {
+        std::memcpy(&header, input.GetData(), sizeof(Header));
+    } // if file is large enough to hold a header
+    if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0
+       || header.version != Version
+       || header.capacity == 0
+       || input.GetSize() < HeaderSize + header.capacity) {
+        const std::string failMsg{"Invalid configuration: " + std::string{path} + " is not a flight recorder file."};
+        return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+    } // if header is invalid
+
+    const char* ring{reinterpret_cast<const char*>(input.GetData() + HeaderSize)};
+    const std::uint64_t end{header.writePosition};
+    const std::uint64_t numBytes{std::min<std::uint64_t>(end, header.capacity)};
+    const std::size_t startOffset{static_cast<std::size_t>((end - numBytes) % header.capacity)};
+    const std::size_t firstPart{std::min<std::size_t>(static_cast<std::size_t>(numBytes), header.capacity - startOffset)};
+    std::string contents;
+    contents.reserve(static_cast<std::size_t>(numBytes));
+    contents.append(ring + startOffset, firstPart);
+    contents.append(ring, static_cast<std::size_t>(numBytes) - firstPart);
+    if(end > header.capacity) {
+        // The ring has wrapped, so the oldest record was partly overwritten; drop it
+        const std::size_t firstNewline{contents.find('\n')};
+        contents.erase(0, firstNewline == std::string::npos ? contents.size() : firstNewline + 1);
+    } // if ring has wrapped
+    return contents;
+}
+
+farcical::engine::FlightRecorder::Header* farcical::engine::FlightRecorder::GetHeader() {
+    return reinterpret_cast<Header*>(file.GetData());
+}
@@ -0,0 +1,100 @@
+//
+// Created by dgmuller on 9/5/25.
+//
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include "../../include/engine/id.hpp"
+
+namespace {
+    // Names are stored in a deque so that the string_views used as keys never dangle as the table grows.
+    struct NameTable {
+        std::shared_mutex mutex;
+        std::deque<std::string> names{std::string{}};
+        std::unordered_map<std::string_view, farcical::engine::EntityID::Value> values{{names.front(), 0}};
+    };
+
+    NameTable& GetNameTable() {
+        static NameTable table;
+        return table;
+    }
+}
+
+farcical::engine::EntityID::Value farcical::engine::EntityID::Intern(std::string_view name) {
+    if(name.empty()) {
+        return Empty;
+    } // if name.empty()
+    NameTable& table{GetNameTable()};
+    {
+        std::shared_lock lock{table.mutex};
+        const auto& findValue{table.values.find(name)};
+        if(findValue != table.values.end()) {
+            return findValue->second;
+        } // if findValue != values.end()
+    }
+    std::unique_lock lock{table.mutex};
+    // Another thread may have interned the same name while we waited for the lock
+    const auto& findValue{table.values.find(name)};
+    if(findValue != table.values.end()) {
+        return findValue->second;
+    } // if findValue != values.end()
+    const Value value{static_cast<Value>(table.names.size())};
+    const std::string& storedName{table.names.emplace_back(name)};
+    table.values.emplace(storedName, value);
+    return value;
+}
+
+const std::string& farcical::engine::EntityID::GetName() const {
+    NameTable& table{GetNameTable()};
+    std::shared_lock lock{table.mutex};
+    return table.names[value];
+}
+
+std::optional<farcical::engine::EntityID> farcical::engine::EntityID::Find(std::string_view name) {
+    if(name.empty()) {
+        return EntityID{};
+    } // if name.empty()
+    NameTable& table{GetNameTable()};
+    std::shared_lock lock{table.mutex};
+    const auto& findValue{table.values.find(name)};
+    if(findValue == table.values.end()) {
+        return std::nullopt;
+    } // if name was never interned
+    return EntityID{findValue->second};
+}
+
+std::size_t farcical::engine::EntityID::GetNumInterned() {
+    NameTable& table{GetNameTable()};
+    std::shared_lock lock{table.mutex};
+    return table.names.size();
+}
+
+std::string farcical::engine::operator+(const EntityID& lhs, std::string_view rhs) {
+    std::string result{lhs.GetName()};
+    result.append(rhs);
+    return result;
+}
+
+std::string farcical::engine::operator+(std::string_view lhs, const EntityID& rhs) {
+    std::string result{lhs};
+    result.append(rhs.GetName());
+    return result;
+}
+
+std::string farcical::engine::operator+(const EntityID& lhs, const char* rhs) {
+    return lhs + std::string_view{rhs};
+}
+
+std::string farcical::engine::operator+(const char* lhs, const EntityID& rhs) {
+    return std::string_view{lhs} + rhs;
+}
+
+std::string farcical::engine::operator+(const EntityID& lhs, const std::string& rhs) {
+    return lhs + std::string_view{rhs};
+}
+
+std::string farcical::engine::operator+(const std::string& lhs, const EntityID& rhs) {
+    return std::string_view{lhs} + rhs;
+}
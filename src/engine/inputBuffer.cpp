@@ -0,0 +1,53 @@
+//
+// Created by dgmuller on 9/2/25.
+//
+#include "../../include/engine/inputBuffer.hpp"
+
+farcical::engine::InputBuffer::InputBuffer() : records{},
+                                               head{0},
+                                               size{0} {
+}
+
+bool farcical::engine::InputBuffer::Push(const sf::Event& event) {
+    if(IsFull()) {
+        return false;
+    } // if buffer is full
+    records[(head + size) % Capacity].emplace(InputRecord{event, clock.getElapsedTime()});
+    ++size;
+    return true;
+}
+
+std::optional<farcical::engine::InputRecord> farcical::engine::InputBuffer::Pop() {
+    if(IsEmpty()) {
+        return std::nullopt;
+    } // if buffer is empty
+    std::optional<InputRecord> record{std::move(records[head])};
+    records[head].reset();
+    head = (head + 1) % Capacity;
+    --size;
+    return record;
+}
+
+void farcical::engine::InputBuffer::Clear() {
+    for(auto& record: records) {
+        record.reset();
+    } // for each record
+    head = 0;
+    size = 0;
+}
+
+bool farcical::engine::InputBuffer::IsEmpty() const {
+    return size == 0;
+}
+
+bool farcical::engine::InputBuffer::IsFull() const {
+    return size == Capacity;
+}
+
+std::size_t farcical::engine::InputBuffer::GetSize() const {
+    return size;
+}
+
+sf::Time farcical::engine::InputBuffer::GetTime() const {
+    return clock.getElapsedTime();
+}
@@ -1,12 +1,43 @@
 //
 // Created by dgmuller on 7/21/25.
 //
+#include <chrono>
 #include "../../include/engine/logInterface.hpp"
 #include "../../include/engine/system/log.hpp"
+#include "../../include/engine/threadIndex.hpp"
 
-farcical::engine::LogInterface::LogInterface(LogSystem& logSystem) : logSystem{logSystem} {
+std::string_view farcical::engine::GetLogLevelName(LogLevel level) {
+    switch(level) {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO ";
+        case LogLevel::Warning: return "WARN ";
+        case LogLevel::Error: return "ERROR";
+    } // switch level
+    return "?????";
 }
 
-void farcical::engine::LogInterface::WriteToLog(std::string_view message) const {
-    logSystem.AddMessage(message);
-}
\ No newline at end of file
+farcical::engine::LogInterface::LogInterface(LogSystem& logSystem, std::string_view source) : logSystem{logSystem},
+    source{source} {
+}
+
+std::string_view farcical::engine::LogInterface::GetLogSource() const {
+    return source;
+}
+
+bool farcical::engine::LogInterface::IsLogLevelEnabled(LogLevel level) const {
+    return logSystem.IsLevelEnabled(level);
+}
+
+std::string farcical::engine::LogInterface::BeginLogRecord(LogLevel level) const {
+    const auto now{std::chrono::floor<std::chrono::milliseconds>(std::chrono::system_clock::now())};
+    std::string record;
+    record.reserve(128);
+    std::format_to(std::back_inserter(record), "{:%F %T} {} [T{}] [{}] ",
+                   now, GetLogLevelName(level), GetThreadIndex(), source);
+    return record;
+}
+
+void farcical::engine::LogInterface::SubmitLogRecord(std::string record) const {
+    logSystem.AddMessage(std::move(record));
+}
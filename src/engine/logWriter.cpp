@@ -0,0 +1,225 @@
+//
+// Created by dgmuller on 9/8/25.
+//
+
+#include <algorithm>
+#include <iostream>
+#include "../../include/engine/logWriter.hpp"
+
+farcical::engine::LogWriter::LogWriter() : rotation{LogRotation::DefaultMaxFileSize, LogRotation::DefaultMaxNumFiles},
+                                           fileSize{0},
+                                           isRunning{false},
+                                           numQueuedBytes{0},
+                                           numFlushesRequested{0},
+                                           numFlushesCompleted{0} {
+}
+
+farcical::engine::LogWriter::~LogWriter() {
+    Close();
+}
+
+std::optional<farcical::engine::Error> farcical::engine::LogWriter::Open(std::string_view path, LogRotation rotation) {
+    if(IsOpen()) {
+        const std::string failMsg{"Invalid configuration: LogWriter is already writing to another file."};
+        return Error{Error::Signal::InvalidConfiguration, failMsg};
+    } // if already open
+    this->path = path;
+    this->rotation = rotation;
+    file.open(this->path, std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+    if(!file.is_open()) {
+        const std::string failMsg{"Invalid path: Could not open Log at " + std::string{path} + "."};
+        return Error{Error::Signal::InvalidPath, failMsg};
+    } // if file could not be opened
+    std::error_code errorCode;
+    fileSize = std::filesystem::file_size(this->path, errorCode);
+    if(errorCode) {
+        fileSize = 0;
+    } // if file size is unknown
+    chunk.reserve(FlushSize + FlushSize / 4);
+    isRunning = true;
+    thread = std::thread{&LogWriter::Run, this};
+    return std::nullopt;
+}
+
+void farcical::engine::LogWriter::Close() {
+    if(thread.joinable()) {
+        {
+            std::lock_guard lock{mutex};
+            isRunning = false;
+        }
+        wakeCondition.notify_one();
+        thread.join();
+    } // if writer thread is running
+    if(file.is_open()) {
+        file.close();
+    } // if file.is_open()
+}
+
+bool farcical::engine::LogWriter::IsOpen() const {
+    return isRunning;
+}
+
+void farcical::engine::LogWriter::Push(std::string line) {
+    const std::size_t lineSize{line.size() + 1};
+    // Counted before it's queued, so Drain never takes away more than has been added
+    const std::size_t numBytes{numQueuedBytes.fetch_add(lineSize, std::memory_order_relaxed) + lineSize};
+    queue.Push(std::move(line));
+    if(numBytes >= FlushSize && numBytes - lineSize < FlushSize) {
+        // Only the push that fills a chunk pays for a notify; the writer sleeps through everything else
+        wakeCondition.notify_one();
+    } // if this line filled a chunk
+}
+
+void farcical::engine::LogWriter::Flush() {
+    std::unique_lock lock{mutex};
+    if(!isRunning) {
+        return;
+    } // if writer is not running
+    const std::uint64_t ticket{++numFlushesRequested};
+    wakeCondition.notify_one();
+    flushedCondition.wait(lock, [this, ticket]() {
+        return numFlushesCompleted >= ticket || !isRunning;
+    });
+}
+
+void farcical::engine::LogWriter::Run() {
+    auto lastWrite{std::chrono::steady_clock::now()};
+    bool keepRunning{true};
+    while(keepRunning) {
+        std::uint64_t flushesRequested;
+        {
+            std::unique_lock lock{mutex};
+            wakeCondition.wait_for(lock, FlushInterval, [this]() {
+                return !isRunning || numFlushesRequested > numFlushesCompleted
+                       || numQueuedBytes.load(std::memory_order_relaxed) >= FlushSize;
+            });
+            keepRunning = isRunning;
+            flushesRequested = numFlushesRequested;
+        }
+
+        Drain();
+        const auto now{std::chrono::steady_clock::now()};
+        const bool isFlushRequested{flushesRequested > numFlushesCompleted};
+        if(!chunk.empty()
+           && (!keepRunning || isFlushRequested || chunk.size() >= FlushSize || now - lastWrite >= FlushInterval)) {
+            WriteChunk();
+            lastWrite = now;
+        } // if chunk should be written
+
+        if(isFlushRequested || !keepRunning) {
+            {
+                std::lock_guard lock{mutex};
+                numFlushesCompleted = flushesRequested;
+            }
+            flushedCondition.notify_all();
+        } // if a flush was requested, or the writer is stopping
+    } // while keepRunning
+}
+
+void farcical::engine::LogWriter::Drain() {
+    while(std::optional line = queue.Pop()) {
+        numQueuedBytes.fetch_sub(line->size() + 1, std::memory_order_relaxed);
+        chunk.append(*line);
+        chunk.push_back('\n');
+        if(chunk.size() >= FlushSize) {
+            WriteChunk();
+        } // if chunk is full
+    } // while queue is not empty
+}
+
+void farcical::engine::LogWriter::WriteChunk() {
+    if(rotation.maxFileSize > 0 && fileSize > 0 && fileSize + chunk.size() > rotation.maxFileSize) {
+        Rotate();
+    } // if chunk would push the file past maxFileSize
+    file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    file.flush();
+    fileSize += chunk.size();
+    chunk.clear();
+}
+
+void farcical::engine::LogWriter::Rotate() {
+    file.close();
+    // Failures here are not fatal: at worst an old file is left behind or the current one keeps growing
+    std::error_code errorCode;
+    if(rotation.maxNumFiles <= 1) {
+        std::filesystem::remove(path, errorCode);
+    } // if only the current file is kept
+    else {
+        std::filesystem::remove(GetRotatedPath(path, rotation.maxNumFiles - 1), errorCode);
+        for(std::size_t index = rotation.maxNumFiles - 1; index > 0; --index) {
+            const std::filesystem::path from{GetRotatedPath(path, index - 1)};
+            if(std::filesystem::exists(from, errorCode)) {
+                std::filesystem::rename(from, GetRotatedPath(path, index), errorCode);
+            } // if from exists
+        } // for each file, oldest first
+    } // else keep maxNumFiles - 1 older files
+    file.open(path, std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+    if(!file.is_open()) {
+        // There is nowhere else to report that the log itself is unavailable
+        std::cerr << "Invalid path: Could not reopen Log at " << path.string() << " after rotating it." << std::endl;
+    } // if file could not be reopened
+    fileSize = std::filesystem::file_size(path, errorCode);
+    if(errorCode) {
+        fileSize = 0;
+    } // if file size is unknown
+}
+
+std::filesystem::path farcical::engine::LogWriter::GetRotatedPath(const std::filesystem::path& path, std::size_t index) {
+    if(index == 0) {
+        return path;
+    } // if index == 0
+    std::filesystem::path rotatedPath{path};
+    rotatedPath.replace_filename(path.stem().string() + "." + std::to_string(index) + path.extension().string());
+    return rotatedPath;
+}
+
+std::expected<std::vector<std::string>, farcical::engine::Error> farcical::engine::LogWriter::ReadTail(
+    std::string_view path, std::size_t numLines) {
+    std::ifstream input{std::string{path}, std::ios_base::in | std::ios_base::binary};
+    if(!input.is_open()) {
+        const std::string failMsg{"Invalid path: Could not open Log at " + std::string{path} + "."};
+        return std::unexpected(Error{Error::Signal::InvalidPath, failMsg});
+    } // if input could not be opened
+    std::vector<std::string> lines;
+    if(numLines == 0) {
+        return lines;
+    } // if numLines == 0
+    input.seekg(0, std::ios_base::end);
+    const std::streamoff fileSize{input.tellg()};
+
+    // Walk backwards a block at a time until numLines newlines have been seen, not counting one at the very end
+    constexpr std::streamoff blockSize{4096};
+    std::string block(static_cast<std::size_t>(blockSize), '\0');
+    std::streamoff position{fileSize};
+    std::streamoff tailStart{0};
+    std::size_t numNewlines{0};
+    bool isStartFound{false};
+    while(position > 0 && !isStartFound) {
+        const std::streamoff readSize{std::min(blockSize, position)};
+        position -= readSize;
+        input.seekg(position);
+        input.read(block.data(), readSize);
+        for(std::streamoff offset = readSize; offset > 0; --offset) {
+            const std::streamoff filePosition{position + offset - 1};
+            if(block[static_cast<std::size_t>(offset - 1)] != '\n' || filePosition == fileSize - 1) {
+                continue;
+            } // if not a line break, or the file's final newline
+            if(++numNewlines == numLines) {
+                tailStart = filePosition + 1;
+                isStartFound = true;
+                break;
+            } // if enough lines were found
+        } // for each byte in block, last first
+    } // while start of tail not found
+
+    input.clear();
+    input.seekg(tailStart);
+    std::string line;
+    while(std::getline(input, line)) {
+        if(!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        } // if line ends with a carriage return
+        lines.push_back(std::move(line));
+    } // while lines remain
+    return lines;
+}
@@ -0,0 +1,202 @@
+//
+// Created by dgmuller on 9/10/25.
+//
+
+#include <string>
+#include <utility>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "../../include/engine/mappedFile.hpp"
+
+farcical::engine::MappedFile::MappedFile() : data{nullptr},
+                                             size{0},
+#ifdef _WIN32
+                                             fileHandle{INVALID_HANDLE_VALUE},
+                                             mappingHandle{nullptr} {
+#else
+                                             fileDescriptor{-1} {
+#endif
+}
+
+farcical::engine::MappedFile::~MappedFile() {
+    Close();
+}
+
+farcical::engine::MappedFile::MappedFile(MappedFile&& other) noexcept : MappedFile() {
+    *this = std::move(other);
+}
+
+farcical::engine::MappedFile& farcical::engine::MappedFile::operator=(MappedFile&& other) noexcept {
+    if(this != &other) {
+        Close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+#ifdef _WIN32
+        fileHandle = std::exchange(other.fileHandle, INVALID_HANDLE_VALUE);
+        mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#else
+        fileDescriptor = std::exchange(other.fileDescriptor, -1);
+#endif
+    } // if this != &other
+    return *this;
+}
+
+std::optional<farcical::engine::Error> farcical::engine::MappedFile::Open(std::string_view path,
+                                                                          Mode mode,
+                                                                          std::size_t size) {
+    Close();
+    const std::string pathString{path};
+    const bool isWritable{mode == Mode::ReadWrite};
+    if(isWritable && size == 0) {
+        const std::string failMsg{"Unexpected value: MappedFile size for " + pathString + " = 0."};
+        return Error{Error::Signal::UnexpectedValue, failMsg};
+    } // if writable mapping is empty
+#ifdef _WIN32
+    fileHandle = CreateFileA(pathString.c_str(),
+                             isWritable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                             FILE_SHARE_READ | FILE_SHARE_WRITE,
+                             nullptr,
+                             isWritable ? OPEN_ALWAYS : OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             nullptr);
+    if(fileHandle == INVALID_HANDLE_VALUE) {
+        const std::string failMsg{"Invalid path: Could not open " + pathString + " for mapping."};
+        return Error{Error::Signal::InvalidPath, failMsg};
+    } // if file could not be opened
+    if(isWritable) {
+        LARGE_INTEGER newSize{};
+        newSize.QuadPart = static_cast<LONGLONG>(size);
+        if(!SetFilePointerEx(fileHandle, newSize, nullptr, FILE_BEGIN) || !SetEndOfFile(fileHandle)) {
+            Close();
+            const std::string failMsg{"Error: Failed to resize " + pathString + " for mapping."};
+            return Error{Error::Signal::WriteFailure, failMsg};
+        } // if file could not be resized
+    } // if isWritable
+    else {
+        LARGE_INTEGER fileSize{};
+        if(!GetFileSizeEx(fileHandle, &fileSize)) {
+            Close();
+            const std::string failMsg{"Invalid path: Could not read the size of " + pathString + "."};
+            return Error{Error::Signal::InvalidPath, failMsg};
+        } // if size unknown
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+    } // else read only
+    if(size == 0) {
+        Close();
+        const std::string failMsg{"Unexpected value: MappedFile size for " + pathString + " = 0."};
+        return Error{Error::Signal::UnexpectedValue, failMsg};
+    } // if file is empty
+    mappingHandle = CreateFileMappingA(fileHandle, nullptr, isWritable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+    if(mappingHandle) {
+        data = static_cast<std::byte*>(MapViewOfFile(mappingHandle,
+                                                     isWritable ? FILE_MAP_WRITE : FILE_MAP_READ,
+                                                     0,
+                                                     0,
+                                                     size));
+    } // if mappingHandle
+    if(!data) {
+        Close();
+        const std::string failMsg{"Error: Failed to map " + pathString + " into memory."};
+        return Error{Error::Signal::InvalidConfiguration, failMsg};
+    } // if file could not be mapped
+#else
+    fileDescriptor = ::open(pathString.c_str(), isWritable ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+    if(fileDescriptor < 0) {
+        const std::string failMsg{"Invalid path: Could not open " + pathString + " for mapping."};
+        return Error{Error::Signal::InvalidPath, failMsg};
+    } // if file could not be opened
+    if(isWritable) {
+        if(::ftruncate(fileDescriptor, static_cast<off_t>(size)) != 0) {
+            Close();
+            const std::string failMsg{"Error: Failed to resize " + pathString + " for mapping."};
+            return Error{Error::Signal::WriteFailure, failMsg};
+        } // if file could not be resized
+    } // if isWritable
+    else {
+        struct stat fileStatus{};
+        if(::fstat(fileDescriptor, &fileStatus) != 0) {
+            Close();
+            const std::string failMsg{"Invalid path: Could not read the size of " + pathString + "."};
+            return Error{Error::Signal::InvalidPath, failMsg};
+        } // if size unknown
+        size = static_cast<std::size_t>(fileStatus.st_size);
+    } // else read only
+    if(size == 0) {
+        Close();
+        const std::string failMsg{"Unexpected value: MappedFile size for " + pathString + " = 0."};
+        return Error{Error::Signal::UnexpectedValue, failMsg};
+    } // if file is empty
+    void* mapping{
+        ::mmap(nullptr, size, isWritable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fileDescriptor, 0)
+    };
+    if(mapping == MAP_FAILED) {
+        Close();
+        const std::string failMsg{"Error: Failed to map " + pathString + " into memory."};
+        return Error{Error::Signal::InvalidConfiguration, failMsg};
+    } // if file could not be mapped
+    data = static_cast<std::byte*>(mapping);
+#endif
+    this->size = size;
+    return std::nullopt;
+}
+
+void farcical::engine::MappedFile::Close() {
+#ifdef _WIN32
+    if(data) {
+        UnmapViewOfFile(data);
+    } // if data
+    if(mappingHandle) {
+        CloseHandle(mappingHandle);
+        mappingHandle = nullptr;
+    } // if mappingHandle
+    if(fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(fileHandle);
+        fileHandle = INVALID_HANDLE_VALUE;
+    } // if fileHandle
+#else
+    if(data) {
+        ::munmap(data, size);
+    } // if data
+    if(fileDescriptor >= 0) {
+        ::close(fileDescriptor);
+        fileDescriptor = -1;
+    } // if fileDescriptor
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+bool farcical::engine::MappedFile::IsOpen() const {
+    return data != nullptr;
+}
+
+std::byte* farcical::engine::MappedFile::GetData() {
+    return data;
+}
+
+const std::byte* farcical::engine::MappedFile::GetData() const {
+    return data;
+}
+
+std::size_t farcical::engine::MappedFile::GetSize() const {
+    return size;
+}
+
+void farcical::engine::MappedFile::Flush() {
+    if(!data) {
+        return;
+    } // if not open
+#ifdef _WIN32
+    FlushViewOfFile(data, size);
+#else
+    ::msync(data, size, MS_ASYNC);
+#endif
+}
@@ -0,0 +1,109 @@
+//
+// Created by dgmuller on 9/7/25.
+//
+
+#include <algorithm>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include "../../include/engine/profiler.hpp"
+#include "../../include/engine/threadIndex.hpp"
+
+farcical::engine::Profiler& farcical::engine::Profiler::Get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+farcical::engine::Profiler::Profiler() : startTime{std::chrono::steady_clock::now()},
+                                         history{},
+                                         numFrames{0},
+                                         currentFrame{0, 0, 0, {}} {
+}
+
+void farcical::engine::Profiler::BeginFrame() {
+    const std::int64_t now{GetTime()};
+    std::lock_guard lock{mutex};
+    currentFrame.index = numFrames;
+    currentFrame.start = now;
+}
+
+void farcical::engine::Profiler::EndFrame() {
+    const std::int64_t now{GetTime()};
+    std::lock_guard lock{mutex};
+    currentFrame.duration = now - currentFrame.start;
+    // Swap rather than copy, so the oldest frame's sample storage is reused for the next one
+    ProfileFrame& oldest{history[numFrames % HistorySize]};
+    std::swap(oldest, currentFrame);
+    currentFrame.samples.clear();
+    ++numFrames;
+}
+
+void farcical::engine::Profiler::AddSample(const char* name, std::int64_t start, std::int64_t duration) {
+    const std::uint32_t threadID{GetThreadIndex()};
+    std::lock_guard lock{mutex};
+    currentFrame.samples.emplace_back(ProfileSample{name, start, duration, threadID});
+}
+
+std::int64_t farcical::engine::Profiler::GetTime() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+std::size_t farcical::engine::Profiler::GetNumFrames() const {
+    std::lock_guard lock{mutex};
+    return static_cast<std::size_t>(std::min<std::uint64_t>(numFrames, HistorySize));
+}
+
+std::optional<farcical::engine::ProfileFrame> farcical::engine::Profiler::GetFrame(std::size_t framesAgo) const {
+    std::lock_guard lock{mutex};
+    if(framesAgo >= std::min<std::uint64_t>(numFrames, HistorySize)) {
+        return std::nullopt;
+    } // if history doesn't reach back that far
+    return history[(numFrames - 1 - framesAgo) % HistorySize];
+}
+
+std::optional<farcical::engine::Error> farcical::engine::Profiler::WriteTrace(std::string_view path) const {
+    nlohmann::json events = nlohmann::json::array();
+    const auto& addEvent{
+        [&events](std::string_view name, std::string_view category, std::int64_t start, std::int64_t duration,
+                  std::uint32_t threadID) {
+            events.push_back(nlohmann::json{
+                {"name", name},
+                {"cat", category},
+                {"ph", "X"},
+                {"ts", start},
+                {"dur", duration},
+                {"pid", 1},
+                {"tid", threadID}
+            });
+        }
+    };
+    const auto& addFrame{
+        [&addEvent](const ProfileFrame& frame, bool isComplete) {
+            if(isComplete) {
+                addEvent("Frame " + std::to_string(frame.index), "frame", frame.start, frame.duration, 0);
+            } // if isComplete
+            for(const auto& sample: frame.samples) {
+                addEvent(sample.name, "farcical", sample.start, sample.duration, sample.threadID);
+            } // for each sample in frame
+        }
+    };
+    {
+        std::lock_guard lock{mutex};
+        const std::uint64_t numStored{std::min<std::uint64_t>(numFrames, HistorySize)};
+        for(std::uint64_t index = numFrames - numStored; index < numFrames; ++index) {
+            addFrame(history[index % HistorySize], true);
+        } // for each frame in history, oldest first
+        addFrame(currentFrame, false);
+    }
+
+    std::ofstream output{std::string{path}, std::ios_base::out};
+    if(!output.is_open()) {
+        const std::string failMsg{"Error: Failed to open \"" + std::string{path} + "\" to write profiler trace."};
+        return Error{Error::Signal::WriteFailure, failMsg};
+    } // if output could not be opened
+    output << nlohmann::json{{"traceEvents", events}, {"displayTimeUnit", "ms"}} << std::endl;
+    if(!output.good()) {
+        const std::string failMsg{"Error: Failed to write profiler trace to \"" + std::string{path} + "\"."};
+        return Error{Error::Signal::WriteFailure, failMsg};
+    } // if write failed
+    return std::nullopt;
+}
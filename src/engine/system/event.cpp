@@ -3,6 +3,7 @@
 //
 #include "../../../include/engine/system/event.hpp"
 #include "../../../include/game/game.hpp"
+#include "../../../include/engine/profiler.hpp"
 
 farcical::engine::EventSystem::EventSystem(game::Game& game, Engine& engine) : System(ID::EventSystem,
                                                                                    engine.GetLogSystem(), nullptr),
@@ -19,11 +20,16 @@ void farcical::engine::EventSystem::Enqueue(const Event& event) {
     eventQueue.push_back(event);
 }
 
+bool farcical::engine::EventSystem::IsQueueEmpty() const {
+    return eventQueue.empty();
+}
+
 void farcical::engine::EventSystem::Init() {
-    WriteToLog("EventSystem initialized.");
+    LogInfo("EventSystem initialized.");
 }
 
 void farcical::engine::EventSystem::Update() {
+    FARCICAL_PROFILE_SCOPE("EventSystem::Update");
     // Iterate through a copy of the eventQueue, to prevent changes to the queue from messing up our iteration
     const auto queueCopy{eventQueue};
     eventQueue.clear();
@@ -46,19 +52,18 @@ void farcical::engine::EventSystem::Update() {
 
 void farcical::engine::EventSystem::Stop() {
     eventQueue.clear();
-    WriteToLog("EventSystem successfully shut down.");
+    LogInfo("EventSystem successfully shut down.");
 }
 
-std::expected<farcical::engine::EventComponent*, farcical::engine::Error> farcical::engine::EventSystem::
+std::expected<farcical::engine::ComponentHandle, farcical::engine::Error> farcical::engine::EventSystem::
 CreateEventComponent(const std::vector<Event::Type>& handledTypes, EventHandler* handler, EntityID parentID) {
-    const auto& createComponentResult{
-        components.emplace(parentID, std::make_unique<EventComponent>(parentID))
-    };
-    if(!createComponentResult.second) {
+    if(handles.contains(parentID)) {
         const std::string failMsg{"Failed to create EventComponent for Widget with ID=\"" + parentID + "\"."};
         return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
-    } // if createComponentResult == failure
-    EventComponent* component{createComponentResult.first->second.get()};
+    } // if parentID already has an EventComponent
+    const ComponentHandle handle{components.Emplace(parentID)};
+    handles.emplace(parentID, handle);
+    EventComponent* component{components.Get(handle)};
     component->handledTypes = handledTypes;
     for(const auto& eventType: handledTypes) {
         // Ensure EventType is valid
@@ -72,20 +77,20 @@ CreateEventComponent(const std::vector<Event::Type>& handledTypes, EventHandler*
         handlerList.push_back(handler);
     } // for each handled Event::Type
     component->handler = handler;
-    return component;
+    return handle;
 }
 
 std::optional<farcical::engine::Error> farcical::engine::EventSystem::DestroyEventComponent(EntityID parentID) {
-    const auto& findComponent{components.find(parentID)};
-    if(findComponent == components.end()) {
+    const auto& findHandle{handles.find(parentID)};
+    const EventComponent* component{findHandle != handles.end() ? components.Get(findHandle->second) : nullptr};
+    if(!component) {
         const std::string failMsg{
             "Error: Could not find EventComponent for Widget with ID=\"" + parentID +
             "\", which was requested to be destroyed."
         };
         return Error{Error::Signal::InvalidConfiguration, failMsg};
-    } // if findComponent == failure
-    EventComponent* component{findComponent->second.get()};
-    for(const auto& eventType: findComponent->second->handledTypes) {
+    } // if component not found
+    for(const auto& eventType: component->handledTypes) {
         // Ensure EventType is valid
         const int eventIndex{static_cast<int>(eventType)};
         if(eventIndex < 0 || eventIndex >= static_cast<int>(Event::Type::NumEventTypes)) {
@@ -101,7 +106,8 @@ std::optional<farcical::engine::Error> farcical::engine::EventSystem::DestroyEve
             } // if this iterator matches the component's EventHandler*
         } // for each EventHandler in HandlerList
     } // for each handled Event::Type
-    components.erase(findComponent);
+    components.Remove(findHandle->second);
+    handles.erase(findHandle);
     return std::nullopt;
 }
 
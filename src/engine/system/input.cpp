@@ -1,86 +1,125 @@
 //
 // Created by dgmuller on 6/9/25.
 //
+#include <algorithm>
 #include "../../../include/engine/system/input.hpp"
 
 #include "../../../include/engine/errorHandler.hpp"
+#include "../../../include/engine/profiler.hpp"
+#include "../../../include/geometry.hpp"
 
-farcical::engine::InputSystem::InputSystem(sf::RenderWindow& window,
+farcical::engine::InputSystem::InputSystem(InputBuffer& inputBuffer,
                                            LogSystem& logSystem,
                                            ErrorGenerator* errorGenerator) : System(System::ID::InputSystem, logSystem,
                                                                                  errorGenerator),
-                                                                             window{window} {}
+                                                                             inputBuffer{inputBuffer},
+                                                                             latency{sf::Time::Zero, sf::Time::Zero, 0},
+                                                                             numMovesCoalesced{0} {}
 
-void farcical::engine::InputSystem::Init() { WriteToLog("InputSystem initialized."); }
+void farcical::engine::InputSystem::Init() { LogInfo("InputSystem initialized."); }
 
 void farcical::engine::InputSystem::Update() {
-    if(window.isOpen()) {
-        while(const std::optional event = window.pollEvent()) {
-            if(event->is<sf::Event::Closed>()) {
-                window.close();
-                break;
-            } // if(event == Closed)
-
-            // Broadcast Mouse Movements
-            if(const auto* mouseMoved = event->getIf<sf::Event::MouseMoved>()) {
-                for(const auto& listener: mouseListeners) { listener->ReceiveMouseMovement(mouseMoved->position); }
-            } // else if(event == MouseMoved)
-
-            // Broadcast Mouse Button Presses
-            else if(const auto* mouseButtonPressed = event->getIf<sf::Event::MouseButtonPressed>()) {
-                for(const auto& listener: mouseListeners) {
-                    listener->ReceiveMouseButtonPress(mouseButtonPressed->button, mouseButtonPressed->position);
-                } // for each mouseListener
-            } // else if(event == MouseButtonPressed)
-
-            // Broadcast Mouse Button Releases
-            else if(const auto* mouseButtonReleased = event->getIf<sf::Event::MouseButtonReleased>()) {
-                for(const auto& listener: mouseListeners) {
-                    listener->ReceiveMouseButtonRelease(mouseButtonReleased->button, mouseButtonReleased->position);
-                } // for each mouseListener
-            } // else if(event == MouseButtonReleased)
-
-            // Broadcast Key Presses
-            else if(const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
-                for(const auto& listener: keyboardListeners) { listener->ReceiveKeyboardInput(keyPressed->code); }
-                // for each keyListener
-            } // else if(event == KeyPressed)
-        } // while(event = pollEvent())
-    } // if(window isOpen)
+    FARCICAL_PROFILE_SCOPE("InputSystem::Update");
+    // The Engine is the only one to poll the window, so everything it drained this frame is waiting here.
+    // Consecutive mouse movements are coalesced into the last one; anything else flushes the pending movement first,
+    // so presses & releases are still delivered in the order they happened.
+    std::optional<sf::Event> pendingMove;
+    while(const std::optional record = inputBuffer.Pop()) {
+        const sf::Time eventLatency{inputBuffer.GetTime() - record->timestamp};
+        latency.max = std::max(latency.max, eventLatency);
+        latency.total += eventLatency;
+        ++latency.numEvents;
+        if(record->event.is<sf::Event::MouseMoved>()) {
+            if(pendingMove.has_value()) {
+                ++numMovesCoalesced;
+            } // if pendingMove is being superseded
+            pendingMove.emplace(record->event);
+            continue;
+        } // if(event == MouseMoved)
+        if(pendingMove.has_value()) {
+            HandleEvent(*pendingMove);
+            pendingMove.reset();
+        } // if pendingMove
+        HandleEvent(record->event);
+    } // while(record = inputBuffer.Pop())
+    if(pendingMove.has_value()) {
+        HandleEvent(*pendingMove);
+    } // if pendingMove
 }
 
-void farcical::engine::InputSystem::Stop() { WriteToLog("InputSystem successfully shut down."); }
+void farcical::engine::InputSystem::HandleEvent(const sf::Event& event) {
+    if(const auto* mouseMoved = event.getIf<sf::Event::MouseMoved>()) {
+        DispatchMouseEvent(event, mouseMoved->position);
+    } // if(event == MouseMoved)
+
+    else if(const auto* mouseButtonPressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+        DispatchMouseEvent(event, mouseButtonPressed->position);
+    } // else if(event == MouseButtonPressed)
+
+    else if(const auto* mouseButtonReleased = event.getIf<sf::Event::MouseButtonReleased>()) {
+        DispatchMouseEvent(event, mouseButtonReleased->position);
+    } // else if(event == MouseButtonReleased)
+
+    // Broadcast Key Presses
+    else if(const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+        for(const auto& listener: keyboardListeners) { listener->ReceiveKeyboardInput(keyPressed->code); }
+        // for each keyListener
+    } // else if(event == KeyPressed)
+}
+
+const farcical::engine::InputLatency& farcical::engine::InputSystem::GetLatency() const {
+    return latency;
+}
+
+std::uint64_t farcical::engine::InputSystem::GetNumMovesCoalesced() const {
+    return numMovesCoalesced;
+}
 
-std::expected<farcical::engine::InputComponent*, farcical::engine::Error>
+void farcical::engine::InputSystem::Stop() {
+    if(latency.numEvents > 0) {
+        const sf::Time average{latency.total / static_cast<std::int64_t>(latency.numEvents)};
+        LogInfo("InputSystem handled {} events with an average latency of {}us (max {}us); {} mouse movements were "
+                "coalesced.", latency.numEvents, average.asMicroseconds(), latency.max.asMicroseconds(), numMovesCoalesced);
+    } // if numEvents > 0
+    LogInfo("InputSystem successfully shut down.");
+}
+
+std::expected<farcical::engine::ComponentHandle, farcical::engine::Error>
 farcical::engine::InputSystem::CreateInputComponent(
     MouseInterface* mouse,
     KeyboardInterface* keyboard,
-    EntityID parentID) {
-    const auto& createComponentResult{
-        components.emplace(parentID, std::make_unique<InputComponent>(parentID))
-    };
-    if(!createComponentResult.second) {
+    EntityID parentID,
+    sf::IntRect bounds) {
+    if(handles.contains(parentID)) {
         const std::string failMsg{"Failed to create InputComponent for Widget with ID=\"" + parentID + "\"."};
         return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
-    } // if createComponentResult == failure
-    InputComponent* component{createComponentResult.first->second.get()};
+    } // if parentID already has an InputComponent
+    const ComponentHandle handle{components.Emplace(parentID)};
+    handles.emplace(parentID, handle);
+    InputComponent* component{components.Get(handle)};
     component->keyboard = keyboard;
     component->mouse = mouse;
+    component->bounds = bounds;
     if(keyboard) { keyboardListeners.emplace_back(component->keyboard); } // if keyboard
-    if(mouse) { mouseListeners.emplace_back(component->mouse); } // if mouse
-    return component;
+    if(mouse) { AddToGrid(handle, *component); } // if mouse
+    return handle;
 }
 
 std::optional<farcical::engine::Error> farcical::engine::InputSystem::DestroyInputComponent(EntityID parentID) {
-    const auto& findComponent{components.find(parentID)};
-    if(findComponent == components.end()) {
+    const auto& findHandle{handles.find(parentID)};
+    if(findHandle == handles.end()) {
         const std::string failMsg{
             "Error: Could not find InputComponent for Widget with ID=\"" + parentID +
             "\", which was requested to be destroyed."
         };
         return Error{Error::Signal::InvalidConfiguration, failMsg};
-    } // if findComponent == failure
-    InputComponent* component{findComponent->second.get()};
+    } // if findHandle == failure
+    const ComponentHandle handle{findHandle->second};
+    handles.erase(findHandle);
+    const InputComponent* component{components.Get(handle)};
+    if(!component) {
+        return std::nullopt;
+    } // if component was already destroyed
     if(component->keyboard) {
         for(auto keyIter = keyboardListeners.begin(); keyIter != keyboardListeners.end(); ++keyIter) {
             if(*keyIter == component->keyboard) {
@@ -90,13 +129,124 @@ std::optional<farcical::engine::Error> farcical::engine::InputSystem::DestroyInp
         } // for each keyboardListener
     } // if keyboard
     if(component->mouse) {
-        for(auto mouseIter = mouseListeners.begin(); mouseIter != mouseListeners.end(); ++mouseIter) {
-            if(*mouseIter == component->mouse) {
-                mouseListeners.erase(mouseIter);
-                break;
-            } // if mouseListener for parentID is found
-        } // for each mouseListener
+        RemoveFromGrid(handle, *component);
+        std::erase(hovered, handle);
     } // if mouse
-    components.erase(findComponent);
+    components.Remove(handle);
     return std::nullopt;
-}
\ No newline at end of file
+}
+
+farcical::engine::InputComponent* farcical::engine::InputSystem::GetInputComponent(ComponentHandle handle) {
+    return components.Get(handle);
+}
+
+std::optional<farcical::engine::Error> farcical::engine::InputSystem::SetInputBounds(
+    EntityID parentID, sf::IntRect bounds) {
+    const auto& findHandle{handles.find(parentID)};
+    InputComponent* component{findHandle != handles.end() ? components.Get(findHandle->second) : nullptr};
+    if(!component) {
+        const std::string failMsg{"Error: Could not find InputComponent for Widget with ID=\"" + parentID + "\"."};
+        return Error{Error::Signal::InvalidConfiguration, failMsg};
+    } // if component not found
+    if(component->mouse) {
+        RemoveFromGrid(findHandle->second, *component);
+        component->bounds = bounds;
+        AddToGrid(findHandle->second, *component);
+    } // if mouse
+    else {
+        component->bounds = bounds;
+    } // else no mouse
+    return std::nullopt;
+}
+
+int farcical::engine::InputSystem::GetCellIndex(int coordinate) {
+    // Floor division, so that negative coordinates land in the correct cell
+    return coordinate >= 0 ? coordinate / GridCellSize : (coordinate - GridCellSize + 1) / GridCellSize;
+}
+
+std::uint64_t farcical::engine::InputSystem::GetCellKey(int cellX, int cellY) {
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellY)) << 32
+           | static_cast<std::uint32_t>(cellX);
+}
+
+void farcical::engine::InputSystem::AddToGrid(ComponentHandle handle, const InputComponent& component) {
+    const sf::IntRect& bounds{component.bounds};
+    if(bounds.size.x <= 0 || bounds.size.y <= 0) {
+        unboundedListeners.push_back(handle);
+        return;
+    } // if component has no bounds
+    const int firstX{GetCellIndex(bounds.position.x)};
+    const int firstY{GetCellIndex(bounds.position.y)};
+    const int lastX{GetCellIndex(bounds.position.x + bounds.size.x - 1)};
+    const int lastY{GetCellIndex(bounds.position.y + bounds.size.y - 1)};
+    for(int cellY = firstY; cellY <= lastY; ++cellY) {
+        for(int cellX = firstX; cellX <= lastX; ++cellX) {
+            grid[GetCellKey(cellX, cellY)].push_back(handle);
+        } // for each column the bounds overlap
+    } // for each row the bounds overlap
+}
+
+void farcical::engine::InputSystem::RemoveFromGrid(ComponentHandle handle, const InputComponent& component) {
+    const sf::IntRect& bounds{component.bounds};
+    if(bounds.size.x <= 0 || bounds.size.y <= 0) {
+        std::erase(unboundedListeners, handle);
+        return;
+    } // if component has no bounds
+    const int firstX{GetCellIndex(bounds.position.x)};
+    const int firstY{GetCellIndex(bounds.position.y)};
+    const int lastX{GetCellIndex(bounds.position.x + bounds.size.x - 1)};
+    const int lastY{GetCellIndex(bounds.position.y + bounds.size.y - 1)};
+    for(int cellY = firstY; cellY <= lastY; ++cellY) {
+        for(int cellX = firstX; cellX <= lastX; ++cellX) {
+            const auto& findCell{grid.find(GetCellKey(cellX, cellY))};
+            if(findCell != grid.end()) {
+                std::erase(findCell->second, handle);
+                if(findCell->second.empty()) {
+                    grid.erase(findCell);
+                } // if cell is now empty
+            } // if cell found
+        } // for each column the bounds overlap
+    } // for each row the bounds overlap
+}
+
+void farcical::engine::InputSystem::DispatchMouseEvent(const sf::Event& event, sf::Vector2i position) {
+    // Only the cell containing the cursor needs testing, and a component appears in each cell at most once
+    targets.clear();
+    const auto& findCell{grid.find(GetCellKey(GetCellIndex(position.x), GetCellIndex(position.y)))};
+    if(findCell != grid.end()) {
+        for(const auto& handle: findCell->second) {
+            const InputComponent* component{components.Get(handle)};
+            if(component && IsPointWithinRect(position, component->bounds)) {
+                targets.push_back(handle);
+            } // if cursor is within component's bounds
+        } // for each component in cell
+    } // if cell found
+    const std::size_t numUnderCursor{targets.size()};
+
+    // Components the cursor has just left still need to hear about it, so they can drop their hover state
+    for(const auto& handle: hovered) {
+        if(std::find(targets.begin(), targets.begin() + static_cast<std::ptrdiff_t>(numUnderCursor), handle)
+           == targets.begin() + static_cast<std::ptrdiff_t>(numUnderCursor)) {
+            targets.push_back(handle);
+        } // if component is no longer under the cursor
+    } // for each previously hovered component
+    hovered.assign(targets.begin(), targets.begin() + static_cast<std::ptrdiff_t>(numUnderCursor));
+    targets.insert(targets.end(), unboundedListeners.begin(), unboundedListeners.end());
+
+    for(const auto& handle: targets) {
+        // A listener may have destroyed components in response to an earlier target
+        const InputComponent* component{components.Get(handle)};
+        if(!component) {
+            continue;
+        } // if component no longer exists
+        if(const auto* mouseMoved = event.getIf<sf::Event::MouseMoved>()) {
+            component->mouse->ReceiveMouseMovement(mouseMoved->position);
+        } // if(event == MouseMoved)
+        else if(const auto* mouseButtonPressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+            component->mouse->ReceiveMouseButtonPress(mouseButtonPressed->button, mouseButtonPressed->position);
+        } // else if(event == MouseButtonPressed)
+        else if(const auto* mouseButtonReleased = event.getIf<sf::Event::MouseButtonReleased>()) {
+            component->mouse->ReceiveMouseButtonRelease(mouseButtonReleased->button, mouseButtonReleased->position);
+        } // else if(event == MouseButtonReleased)
+    } // for each target
+}
@@ -0,0 +1,213 @@
+//
+// Created by dgmuller on 9/12/25.
+//
+
+#include "../../../include/engine/system/job.hpp"
+#include "../../../include/engine/profiler.hpp"
+
+namespace {
+    // Which JobSystem (if any) the current thread works for, and its index there
+    thread_local const farcical::engine::JobSystem* currentJobSystem{nullptr};
+    thread_local std::size_t currentWorkerIndex{0};
+}
+
+unsigned int farcical::engine::JobSystem::GetDefaultNumWorkers() {
+    const unsigned int numCores{std::thread::hardware_concurrency()};
+    return numCores > 1 ? numCores - 1 : 1;
+}
+
+farcical::engine::JobSystem::JobSystem(LogSystem& logSystem,
+                                       ErrorGenerator* errorGenerator,
+                                       unsigned int numWorkers) : System(System::ID::JobSystem, logSystem, errorGenerator),
+                                                                  numWorkers{std::max(numWorkers, 1u)},
+                                                                  nextWorker{0},
+                                                                  numQueued{0},
+                                                                  isStopping{false} {
+}
+
+farcical::engine::JobSystem::~JobSystem() {
+    Stop();
+}
+
+void farcical::engine::JobSystem::Init() {
+    if(!workers.empty()) {
+        return;
+    } // if already running
+    isStopping = false;
+    workers.reserve(numWorkers);
+    for(unsigned int index = 0; index < numWorkers; ++index) {
+        workers.push_back(std::make_unique<Worker>());
+    } // for each worker
+    // Only start the threads once every deque exists, since any of them may try to steal from the others
+    for(std::size_t index = 0; index < workers.size(); ++index) {
+        workers[index]->thread = std::thread{&JobSystem::Run, this, index};
+    } // for each worker
+    LogInfo("JobSystem initialized with {} workers.", numWorkers);
+}
+
+void farcical::engine::JobSystem::Update() {
+    FARCICAL_PROFILE_SCOPE("JobSystem::Update");
+    // Workers run continuously; there is nothing to do once per frame
+}
+
+void farcical::engine::JobSystem::Stop() {
+    if(workers.empty()) {
+        return;
+    } // if not running
+    {
+        std::lock_guard lock{sleepMutex};
+        isStopping = true;
+    }
+    wakeCondition.notify_all();
+    for(const auto& worker: workers) {
+        worker->thread.join();
+    } // for each worker
+    // Anything still queued was never started; run it here so no counter is left waiting forever
+    std::vector<std::unique_ptr<Worker>> stoppedWorkers{std::move(workers)};
+    workers.clear();
+    for(const auto& worker: stoppedWorkers) {
+        for(auto& job: worker->jobs) {
+            job();
+        } // for each job left in the deque
+    } // for each worker
+    numQueued = 0;
+    LogInfo("JobSystem successfully shut down.");
+}
+
+unsigned int farcical::engine::JobSystem::GetNumWorkers() const {
+    return numWorkers;
+}
+
+void farcical::engine::JobSystem::Submit(Job job, JobCounter* counter) {
+    if(counter) {
+        counter->count.fetch_add(1, std::memory_order_relaxed);
+    } // if counter
+    Schedule(std::move(job), counter);
+}
+
+void farcical::engine::JobSystem::Schedule(Job job, JobCounter* counter) {
+    if(workers.empty()) {
+        job();
+        Finish(counter);
+        return;
+    } // if there are no workers
+    Push([this, job = std::move(job), counter]() {
+        job();
+        Finish(counter);
+    });
+}
+
+void farcical::engine::JobSystem::Submit(Job job, JobCounter* counter, JobCounter& dependency) {
+    if(counter) {
+        // Count the job now, so waiting on counter also waits for it to be released
+        counter->count.fetch_add(1, std::memory_order_relaxed);
+    } // if counter
+    {
+        std::lock_guard lock{dependency.mutex};
+        if(!dependency.IsDone()) {
+            dependency.continuations.push_back(JobCounter::Continuation{std::move(job), counter});
+            return;
+        } // if dependency is unfinished
+    }
+    Schedule(std::move(job), counter);
+}
+
+void farcical::engine::JobSystem::Wait(JobCounter& counter) {
+    FARCICAL_PROFILE_SCOPE("JobSystem::Wait");
+    const std::size_t workerIndex{currentJobSystem == this ? currentWorkerIndex : NoWorker};
+    while(!counter.IsDone()) {
+        if(!TryRunJob(workerIndex)) {
+            std::this_thread::yield();
+        } // if there was nothing to help with
+    } // while counter is unfinished
+    // The job that finished counter may still be releasing its continuations; let it leave before counter can die
+    std::lock_guard lock{counter.mutex};
+}
+
+void farcical::engine::JobSystem::Run(std::size_t workerIndex) {
+    currentJobSystem = this;
+    currentWorkerIndex = workerIndex;
+    while(true) {
+        if(TryRunJob(workerIndex)) {
+            continue;
+        } // if a job was run
+        std::unique_lock lock{sleepMutex};
+        wakeCondition.wait(lock, [this]() {
+            return isStopping || numQueued.load(std::memory_order_acquire) > 0;
+        });
+        if(isStopping) {
+            return;
+        } // if isStopping
+    } // while running
+}
+
+bool farcical::engine::JobSystem::TryRunJob(std::size_t workerIndex) {
+    Job job;
+    if(workerIndex != NoWorker) {
+        Worker& worker{*workers[workerIndex]};
+        std::lock_guard lock{worker.mutex};
+        if(!worker.jobs.empty()) {
+            job = std::move(worker.jobs.back());
+            worker.jobs.pop_back();
+        } // if own deque has work
+    } // if this thread is a worker
+    if(!job) {
+        const std::size_t numWorkers{workers.size()};
+        const std::size_t start{workerIndex == NoWorker ? 0 : workerIndex + 1};
+        for(std::size_t offset = 0; offset < numWorkers && !job; ++offset) {
+            const std::size_t victimIndex{(start + offset) % numWorkers};
+            if(victimIndex == workerIndex) {
+                continue;
+            } // if victim is this worker
+            Worker& victim{*workers[victimIndex]};
+            std::lock_guard lock{victim.mutex};
+            if(!victim.jobs.empty()) {
+                job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+            } // if victim has work
+        } // for each other worker
+    } // if own deque was empty
+    if(!job) {
+        return false;
+    } // if no job was found
+    numQueued.fetch_sub(1, std::memory_order_relaxed);
+    job();
+    return true;
+}
+
+void farcical::engine::JobSystem::Push(Job job) {
+    // Workers keep their own fan-out; everyone else spreads jobs round-robin
+    const std::size_t workerIndex{
+        currentJobSystem == this ? currentWorkerIndex : nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size()
+    };
+    // Counted before it's visible, so numQueued never dips below the number of jobs that can be taken
+    numQueued.fetch_add(1, std::memory_order_release);
+    {
+        Worker& worker{*workers[workerIndex]};
+        std::lock_guard lock{worker.mutex};
+        worker.jobs.push_back(std::move(job));
+    }
+    {
+        // Taking the lock orders this wake-up after any worker's check of numQueued, so none can be missed
+        std::lock_guard lock{sleepMutex};
+    }
+    wakeCondition.notify_one();
+}
+
+void farcical::engine::JobSystem::Finish(JobCounter* counter) {
+    if(!counter) {
+        return;
+    } // if !counter
+    std::vector<JobCounter::Continuation> released;
+    {
+        std::lock_guard lock{counter->mutex};
+        if(counter->count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            released.swap(counter->continuations);
+        } // if this was the last job
+    }
+    // counter may be gone by now; only the released jobs are touched from here on
+    for(auto& continuation: released) {
+        // Already counted when it was deferred
+        Schedule(std::move(continuation.job), continuation.counter);
+    } // for each job waiting on counter
+}
@@ -1,14 +1,21 @@
 //
 // Created by dgmuller on 7/21/25.
 //
+#include <filesystem>
+#include <iostream>
 #include "../../../include/engine/system/log.hpp"
 #include "../../../include/resource/manager.hpp"
+#include "../../../include/engine/profiler.hpp"
 
 farcical::engine::LogSystem::LogSystem(ResourceID logID,
-                                       std::string_view logPath) : System(System::ID::LogSystem, *this, nullptr),
-                                                                   logParams{logID, logPath},
-                                                                   resourceManager{nullptr},
-                                                                   log{nullptr} {
+                                       std::string_view logPath,
+                                       LogRotation rotation,
+                                       std::uint32_t flightRecorderSize) : System(System::ID::LogSystem, *this, nullptr),
+                                                                           logParams{logID, logPath},
+                                                                           rotation{rotation},
+                                                                           resourceManager{nullptr},
+                                                                           flightRecorderSize{flightRecorderSize},
+                                                                           level{MinLogLevel} {
 }
 
 void farcical::engine::LogSystem::Init() {
@@ -20,33 +27,69 @@ void farcical::engine::LogSystem::Init() {
     };
     if(createHandle.has_value()) {
         ResourceHandle* handle{createHandle.value()};
-        const auto& loadLogFile{resourceManager->GetLog(handle->id)};
-        if(loadLogFile.has_value()) {
-            log = loadLogFile.value();
-            AddMessage("LogSystem initialized.");
-            resourceManager->WriteLog(handle->id, buffer);
-            buffer.clear();
-        } // if requestLog == success
+        // The file is only ever appended to, so it is kept open by the writer rather than loaded as a resource
+        const auto& openLog{writer.Open(handle->path, rotation)};
+        if(openLog.has_value()) {
+            // There is nowhere else to report that the log itself is unavailable
+            std::cerr << openLog.value().message << std::endl;
+            handle->status = ResourceHandle::Status::Error;
+            return;
+        } // if openLog == failure
+        handle->status = ResourceHandle::Status::IsReady;
+        if(flightRecorderSize > 0) {
+            const std::filesystem::path recorderPath{
+                std::filesystem::path{handle->path}.replace_filename(FlightRecorderFileName)
+            };
+            const auto& openRecorder{flightRecorder.Open(recorderPath.string(), flightRecorderSize)};
+            if(openRecorder.has_value()) {
+                LogWarning("{}", openRecorder.value().message);
+            } // if openRecorder == failure
+        } // if flightRecorderSize > 0
+        LogInfo("LogSystem initialized.");
     } // if createHandle == success
 }
 
 void farcical::engine::LogSystem::Update() {
-    resourceManager->AppendToLog(log, buffer);
-    buffer.clear();
+    FARCICAL_PROFILE_SCOPE("LogSystem::Update");
+    // Messages are written by the LogWriter's own thread as they arrive, so there is nothing to do each frame
 }
 
 void farcical::engine::LogSystem::Stop() {
-    AddMessage("LogSystem shutting down...");
-    if(!buffer.empty()) {
-        Update();
-    }
-    resourceManager->DestroyResourceHandle(logParams.first, ResourceHandle::Type::Log);
+    LogInfo("LogSystem shutting down...");
+    writer.Close();
+    flightRecorder.Close();
+    if(resourceManager) {
+        resourceManager->DestroyResourceHandle(logParams.first, ResourceHandle::Type::Log);
+    } // if resourceManager
 }
 
 void farcical::engine::LogSystem::AddResourceManager(ResourceManager* resourceManager) {
     this->resourceManager = resourceManager;
 }
 
-void farcical::engine::LogSystem::AddMessage(std::string_view message) {
-    buffer.emplace_back(message);
-}
\ No newline at end of file
+void farcical::engine::LogSystem::AddMessage(std::string message) {
+    flightRecorder.Write(message);
+    writer.Push(std::move(message));
+}
+
+void farcical::engine::LogSystem::SetLevel(LogLevel level) {
+    this->level.store(level, std::memory_order_relaxed);
+}
+
+farcical::engine::LogLevel farcical::engine::LogSystem::GetLevel() const {
+    return level.load(std::memory_order_relaxed);
+}
+
+bool farcical::engine::LogSystem::IsLevelEnabled(LogLevel level) const {
+    return level >= MinLogLevel && level >= this->level.load(std::memory_order_relaxed);
+}
+
+void farcical::engine::LogSystem::Flush() {
+    writer.Flush();
+}
+
+std::expected<std::vector<std::string>, farcical::engine::Error> farcical::engine::LogSystem::GetRecentMessages(
+    std::size_t numLines) {
+    writer.Flush();
+    return LogWriter::ReadTail(logParams.second, numLines);
+}
@@ -2,6 +2,7 @@
 // Created by dgmuller on 8/19/25.
 //
 #include "../../../include/engine/system/music.hpp"
+#include "../../../include/engine/profiler.hpp"
 
 farcical::engine::MusicSystem::MusicSystem(ResourceManager& resourceManager,
                                            LogSystem& logSystem,
@@ -9,24 +10,28 @@ farcical::engine::MusicSystem::MusicSystem(ResourceManager& resourceManager,
     System(System::ID::MusicSystem, logSystem, errorGenerator),
     resourceManager{resourceManager},
     currentMusicHandle{nullptr},
-    currentMusic{nullptr} {
+    currentMusic{nullptr},
+    isTransitionPending{false} {
 }
 
 void farcical::engine::MusicSystem::PlayMusic() {
     if(currentMusic) {
         currentMusic->play();
+        isTransitionPending = true;
     } // if currentMusic
 }
 
 void farcical::engine::MusicSystem::PauseMusic() {
     if(currentMusic) {
         currentMusic->pause();
+        isTransitionPending = true;
     } // if currentMusic
 }
 
 void farcical::engine::MusicSystem::StopMusic() {
     if(currentMusic) {
         currentMusic->stop();
+        isTransitionPending = true;
     } // if currentMusic
 }
 
@@ -51,6 +56,7 @@ void farcical::engine::MusicSystem::SetCurrentMusic(ResourceID musicID) {
     const auto& getMusic{resourceManager.GetMusic(musicID)};
     if(getMusic.has_value()) {
         currentMusic = getMusic.value();
+        isTransitionPending = true;
     } // if getMusic == success
 }
 
@@ -60,12 +66,20 @@ void farcical::engine::MusicSystem::ClearCurrentMusic() {
     } // if currentMusic
     currentMusicHandle = nullptr;
     currentMusic = nullptr;
+    isTransitionPending = true;
+}
+
+bool farcical::engine::MusicSystem::IsTransitionPending() const {
+    return isTransitionPending;
 }
 
 void farcical::engine::MusicSystem::Init() {
 }
 
 void farcical::engine::MusicSystem::Update() {
+    FARCICAL_PROFILE_SCOPE("MusicSystem::Update");
+    // sf::Music streams on its own thread, so once a change has been seen by one full frame nothing is pending
+    isTransitionPending = false;
 }
 
 void farcical::engine::MusicSystem::Stop() {
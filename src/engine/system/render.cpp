@@ -2,57 +2,143 @@
 // Created by dgmuller on 5/24/25.
 //
 
+#include <algorithm>
+#include <array>
+#include <utility>
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/Text.hpp>
 #include "../../../include/engine/system/render.hpp"
+#include "../../../include/engine/profiler.hpp"
 
 farcical::engine::RenderSystem::RenderSystem(sf::RenderWindow& window, LogSystem& logSystem, ErrorGenerator* errorGenerator):
   System(ID::RenderSystem, logSystem, errorGenerator),
-  window{window} {
+  window{window},
+  needsRedraw{true},
+  interpolationAlpha{0.0f},
+  numDrawCalls{0},
+  numDrawCallsSaved{0},
+  totalDrawCallsSaved{0},
+  numFrames{0},
+  nextSequence{0} {
 }
 
 void farcical::engine::RenderSystem::Init() {
-  WriteToLog("RenderSystem initialized.");
+  LogInfo("RenderSystem initialized.");
 }
 
 void farcical::engine::RenderSystem::Update() {
+  FARCICAL_PROFILE_SCOPE("RenderSystem::Update");
   if(window.isOpen()) {
     window.clear();
+    numDrawCalls = 0;
+    numDrawCallsSaved = 0;
 
-    for(const auto& context: contexts) {
-      for(const auto& layer: context.layers) {
-        for(const auto& component: layer.componentList) {
-          if(component->texture) {
-            sf::Sprite sprite{*component->texture};
-            sprite.setScale(component->scale);
-            sprite.setPosition(component->position);
-            window.draw(sprite);
-          } // if texture
-          else if(component->font) {
-            const FontProperties& fontProperties{component->fontProperties};
-            sf::Text text{*component->font, component->contents, fontProperties.characterSize};
-            text.setScale(component->scale);
-            text.setPosition(component->position);
-            text.setFillColor(fontProperties.color);
-            text.setOutlineColor(fontProperties.outlineColor);
-            text.setOutlineThickness(fontProperties.outlineThickness);
-            window.draw(text);
-          } // else if font
-        } // for each Component in componentList
+    MarkDirtyLayers();
+    for(auto& context: contexts) {
+      for(auto& layer: context.layers) {
+        const bool needsRebuild{layer.isDirty};
+        if(needsRebuild) {
+          BuildBatches(context.sceneID, layer);
+        } // if needsRebuild
+        if(layer.numComponents == 0) {
+          continue;
+        } // if layer is empty
+        if(layer.isCached) {
+          if(needsRebuild || !layer.cache || layer.cache->getSize() != window.getSize()) {
+            const auto& updateCache{UpdateLayerCache(layer)};
+            if(updateCache.has_value()) {
+              // Fall back to drawing the layer directly
+              LogWarning("{}", updateCache.value().message);
+              layer.isCached = false;
+              layer.cache.reset();
+              DrawBatches(window, layer);
+              continue;
+            } // if updateCache == failure
+          } // if cache is out of date
+          // The cache holds premultiplied color (everything was blended onto transparent black), so composite it
+          // without multiplying by alpha a second time
+          const sf::BlendMode premultipliedAlpha{sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha};
+          window.draw(sf::Sprite{layer.cache->getTexture()}, sf::RenderStates{premultipliedAlpha});
+          ++numDrawCalls;
+          numDrawCallsSaved += layer.numComponents - 1;
+        } // if layer.isCached
+        else {
+          DrawBatches(window, layer);
+        } // else draw layer directly
       } // for each RenderLayer in RenderContext
     } // for each RenderContext
 
     window.display();
+    needsRedraw = false;
+    totalDrawCallsSaved += numDrawCallsSaved;
+    ++numFrames;
   }
 }
 
 void farcical::engine::RenderSystem::Stop() {
   if(window.isOpen()) {
     window.close();
-    WriteToLog("RenderSystem successfully shut down.");
+    if(numFrames > 0) {
+      LogInfo("RenderSystem batching saved {} draw calls over {} frames.", totalDrawCallsSaved, numFrames);
+    } // if numFrames > 0
+    LogInfo("RenderSystem successfully shut down.");
   }
 }
 
+std::optional<farcical::engine::Error> farcical::engine::RenderSystem::SetLayerCached(
+  EntityID sceneID, ui::Layout::Layer::ID layerID, bool isCached) {
+  RenderContext* context{GetRenderContext(sceneID)};
+  if(!context) {
+    const std::string failMsg{"Invalid configuration: RenderContext with id=\"" + sceneID + "\" not found."};
+    return Error{Error::Signal::InvalidConfiguration, failMsg};
+  } // if RenderContext not found
+  RenderLayer& layer{context->layers[static_cast<int>(layerID)]};
+  layer.isCached = isCached;
+  needsRedraw = true;
+  if(!isCached) {
+    layer.cache.reset();
+  } // if !isCached
+  return std::nullopt;
+}
+
+bool farcical::engine::RenderSystem::IsDirty() const {
+  if(needsRedraw) {
+    return true;
+  } // if needsRedraw
+  for(const auto& context: contexts) {
+    for(const auto& layer: context.layers) {
+      if(layer.isDirty) {
+        return true;
+      } // if layer.isDirty
+    } // for each RenderLayer in RenderContext
+  } // for each RenderContext
+  for(const auto& component: components) {
+    if(component.isDirty) {
+      return true;
+    } // if component.isDirty
+  } // for each RenderComponent
+  return false;
+}
+
+void farcical::engine::RenderSystem::RequestRedraw() {
+  needsRedraw = true;
+}
+
+void farcical::engine::RenderSystem::SetInterpolationAlpha(float alpha) {
+  interpolationAlpha = alpha;
+}
+
+float farcical::engine::RenderSystem::GetInterpolationAlpha() const {
+  return interpolationAlpha;
+}
+
+int farcical::engine::RenderSystem::GetNumDrawCalls() const {
+  return numDrawCalls;
+}
+
+int farcical::engine::RenderSystem::GetNumDrawCallsSaved() const {
+  return numDrawCallsSaved;
+}
+
 sf::RenderWindow& farcical::engine::RenderSystem::GetWindow() const {
   return const_cast<sf::RenderWindow&>(window);
 }
@@ -68,9 +154,12 @@ farcical::engine::RenderSystem::CreateRenderContext(engine::EntityID sceneID) {
     return std::unexpected(engine::Error{Error::Signal::InvalidConfiguration, failMsg});
   } // if this RenderContext already exists
   RenderContext& context{contexts.emplace_back(RenderContext{sceneID})};
+  needsRedraw = true;
   for(int index = 0; index < context.layers.size(); ++index) {
     context.layers[index].id = static_cast<ui::Layout::Layer::ID>(index);
   } // assign each Layer its correct LayerID
+  // Backgrounds rarely change after the scene loads, so they are composited from a cache by default
+  context.layers[static_cast<int>(ui::Layout::Layer::ID::Background)].isCached = true;
   return &context;
 }
 
@@ -79,14 +168,19 @@ std::optional<farcical::engine::Error> farcical::engine::RenderSystem::DestroyRe
   for(auto contextIter = contexts.begin(); contextIter != contexts.end(); ++contextIter) {
     // If we find it, loop through each of its RenderLayers and remove all RenderComponents therein
     if(contextIter->sceneID == sceneID) {
-      // Remove RenderComponents before erasing
-      for(const auto& layer: contextIter->layers) {
-        for(const auto& component: layer.componentList) {
-          DestroyRenderComponent(sceneID, component->parentID);
-        } // for each RenderComponent* in layer.componentList
-      } // for each RenderLayer in (*contextIter).layers
+      // Remove RenderComponents before erasing (DestroyRenderComponent swap-removes from components, so copy IDs first)
+      std::vector<EntityID> parentIDs;
+      for(const auto& component: components) {
+        if(component.sceneID == sceneID) {
+          parentIDs.push_back(component.parentID);
+        } // if component belongs to this RenderContext
+      } // for each RenderComponent
+      for(const auto& parentID: parentIDs) {
+        DestroyRenderComponent(sceneID, parentID);
+      } // for each parentID in parentIDs
 
       contexts.erase(contextIter);
+      needsRedraw = true;
       return std::nullopt;
     } // if (*contextIter) is the RenderContext we're meant to destroy
   } // for each RenderContext in contexts
@@ -110,7 +204,7 @@ farcical::engine::RenderContext* farcical::engine::RenderSystem::GetRenderContex
   return contextPtr;
 }
 
-std::expected<farcical::engine::RenderComponent*, farcical::engine::Error>
+std::expected<farcical::engine::ComponentHandle, farcical::engine::Error>
 farcical::engine::RenderSystem::CreateRenderComponent(
   ui::Layout::Layer::ID layerID,
   EntityID sceneID,
@@ -121,22 +215,44 @@ farcical::engine::RenderSystem::CreateRenderComponent(
     const std::string failMsg{"Invalid configuration: RenderContext with id=\"" + sceneID + "\" not found."};
     return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
   } // if RenderContext not found
+  if(handles.contains(parentID)) {
+    const std::string failMsg{"Invalid configuration: Failed to create RenderComponent for " + parentID + "."};
+    return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+  } // if parentID already has a RenderComponent
 
-  const auto& createComponent{
-    components.insert(std::make_pair(parentID, std::make_unique<RenderComponent>(parentID)))
-  };
-  if(createComponent.second) {
-    RenderComponent* component{createComponent.first->second.get()};
-    component->texture = texture;
-    context->layers[static_cast<int>(layerID)].componentList.push_back(component);
-    return component;
-  } // if createComponent == success
+  const ComponentHandle handle{components.Emplace(parentID, sceneID, layerID, nextSequence++)};
+  handles.emplace(parentID, handle);
+  components.Get(handle)->texture = texture;
+  RenderLayer& layer{context->layers[static_cast<int>(layerID)]};
+  ++layer.numComponents;
+  layer.isDirty = true;
+  return handle;
+}
 
-  const std::string failMsg{"Invalid configuration: Failed to create RenderComponent for " + parentID + "."};
-  return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+std::expected<farcical::engine::ComponentHandle, farcical::engine::Error>
+farcical::engine::RenderSystem::CreateRenderComponent(
+  ui::Layout::Layer::ID layerID,
+  EntityID sceneID,
+  EntityID parentID,
+  const NineSlice& nineSlice) {
+  const auto& createComponent{CreateRenderComponent(layerID, sceneID, parentID, nullptr)};
+  if(!createComponent.has_value()) {
+    return std::unexpected(createComponent.error());
+  } // if createComponent == failure
+  // Edges & center are drawn with texture coordinates past their Textures' far edges, which only works if they wrap
+  for(sf::Texture* edge: nineSlice.edges) {
+    if(edge) {
+      edge->setRepeated(true);
+    } // if edge
+  } // for each edge
+  if(nineSlice.center) {
+    nineSlice.center->setRepeated(true);
+  } // if center
+  components.Get(createComponent.value())->SetNineSlice(nineSlice);
+  return createComponent.value();
 }
 
-std::expected<farcical::engine::RenderComponent*, farcical::engine::Error>
+std::expected<farcical::engine::ComponentHandle, farcical::engine::Error>
 farcical::engine::RenderSystem::CreateRenderComponent(
   ui::Layout::Layer::ID layerID,
   EntityID sceneID,
@@ -144,52 +260,243 @@ farcical::engine::RenderSystem::CreateRenderComponent(
   sf::Font* font,
   const FontProperties& fontProperties,
   std::string_view contents) {
-  RenderContext* context{GetRenderContext(sceneID)};
-  if(!context) {
-    const std::string failMsg{"Invalid configuration: RenderContext with id=\"" + sceneID + "\" not found."};
-    return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
-  } // if RenderContext not found
-
-  const auto& createComponent{
-    components.insert(std::make_pair(parentID, std::make_unique<RenderComponent>(parentID)))
-  };
-  if(createComponent.second) {
-    RenderComponent* component{createComponent.first->second.get()};
-    component->font = font;
-    component->fontProperties = fontProperties;
-    component->contents = contents;
-    context->layers[static_cast<int>(layerID)].componentList.push_back(component);
-    return component;
-  } // if createComponent == success
-  const std::string failMsg{"Invalid configuration: Failed to create RenderComponent for " + parentID + "."};
-  return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+  const auto& createComponent{CreateRenderComponent(layerID, sceneID, parentID, nullptr)};
+  if(!createComponent.has_value()) {
+    return std::unexpected(createComponent.error());
+  } // if createComponent == failure
+  RenderComponent* component{components.Get(createComponent.value())};
+  component->SetFont(font);
+  component->SetFontProperties(fontProperties);
+  component->SetContents(contents);
+  return createComponent.value();
 }
 
 std::optional<farcical::engine::Error> farcical::engine::RenderSystem::DestroyRenderComponent(
   EntityID sceneID, EntityID parentID) {
-  RenderContext* context{GetRenderContext(sceneID)};
-  if(!context) {
-    const std::string failMsg{"Invalid Configuration: Failed to find RenderContext with sceneID=\"" + sceneID + "\"."};
-    return Error{Error::Signal::InvalidConfiguration, failMsg};
-  }
-
-  const auto& findComponent{components.find(parentID)};
-  if(findComponent != components.end()) {
-    for(int index = 0; index < static_cast<int>(ui::Layout::Layer::ID::NumLayers); ++index) {
-      bool found{false};
-      for(auto componentIter = context->layers[index].componentList.begin();
-          !found && componentIter != context->layers[index].componentList.end(); ++componentIter) {
-        if((*componentIter)->parentID == parentID) {
-          context->layers[index].componentList.erase(componentIter);
-          found = true;
-        } // if Component found
-      } // for each Component in componentList
-      if(found) {
-        break;
+  const auto& findHandle{handles.find(parentID)};
+  if(findHandle != handles.end()) {
+    const RenderComponent* component{components.Get(findHandle->second)};
+    if(component) {
+      if(component->sceneID != sceneID) {
+        const std::string failMsg{
+          "Invalid Configuration: RenderComponent with parentID=\"" + parentID + "\" belongs to sceneID=\"" +
+          component->sceneID + "\", not \"" + sceneID + "\"."
+        };
+        return Error{Error::Signal::InvalidConfiguration, failMsg};
+      } // if component belongs to another RenderContext
+      // Its layer counts live in the component's own RenderContext
+      RenderContext* context{GetRenderContext(component->sceneID)};
+      if(!context) {
+        const std::string failMsg{
+          "Invalid Configuration: Failed to find RenderContext with sceneID=\"" + component->sceneID + "\"."
+        };
+        return Error{Error::Signal::InvalidConfiguration, failMsg};
       }
-    } // for each layer
-
-    components.erase(findComponent);
+      RenderLayer& layer{context->layers[static_cast<int>(component->layerID)]};
+      --layer.numComponents;
+      layer.isDirty = true;
+      components.Remove(findHandle->second);
+    } // if component is still alive
+    handles.erase(findHandle);
   } // if Component found
   return std::nullopt;
 }
+
+farcical::engine::RenderComponent* farcical::engine::RenderSystem::GetRenderComponent(ComponentHandle handle) {
+  return components.Get(handle);
+}
+
+void farcical::engine::RenderSystem::MarkDirtyLayers() {
+  for(auto& component: components) {
+    if(component.isDirty) {
+      RenderContext* context{GetRenderContext(component.sceneID)};
+      if(context) {
+        context->layers[static_cast<int>(component.layerID)].isDirty = true;
+      } // if context
+      component.isDirty = false;
+    } // if component.isDirty
+  } // for each RenderComponent
+}
+
+void farcical::engine::RenderSystem::BuildBatches(EntityID sceneID, RenderLayer& layer) {
+  FARCICAL_PROFILE_SCOPE("RenderSystem::BuildBatches");
+  layer.batches.clear();
+  // Gather this layer's components in one pass over contiguous storage, then restore their draw order
+  drawOrder.clear();
+  for(std::size_t index = 0; index < components.size(); ++index) {
+    if(components[index].sceneID == sceneID && components[index].layerID == layer.id) {
+      drawOrder.push_back(index);
+    } // if component is drawn in this layer
+  } // for each RenderComponent
+  std::ranges::sort(drawOrder, [this](std::size_t lhs, std::size_t rhs) {
+    return components[lhs].sequence < components[rhs].sequence;
+  });
+
+  for(const auto& index: drawOrder) {
+    RenderComponent* component{&components[index]};
+    component->isDirty = false;
+    if(component->nineSlice.has_value()) {
+      AppendNineSlice(layer, *component);
+    } // if nineSlice
+    else if(component->texture) {
+      const sf::Vector2f textureSize{component->texture->getSize()};
+      const sf::FloatRect bounds{
+        component->position,
+        sf::Vector2f{textureSize.x * component->scale.x, textureSize.y * component->scale.y}
+      };
+      ++AppendQuad(layer, component->texture, bounds, sf::FloatRect{{0.0f, 0.0f}, textureSize}).numComponents;
+    } // else if texture
+    else if(component->font) {
+      const sf::FloatRect bounds{component->GetText()->getGlobalBounds()};
+      layer.batches.emplace_back(RenderBatch{nullptr, components.GetHandle(index), sf::VertexArray{}, bounds, 1});
+    } // else if font
+  } // for each RenderComponent in drawOrder
+  layer.isDirty = false;
+}
+
+farcical::engine::RenderBatch& farcical::engine::RenderSystem::AppendQuad(RenderLayer& layer,
+                                                                         sf::Texture* texture,
+                                                                         const sf::FloatRect& bounds,
+                                                                         const sf::FloatRect& textureRect) {
+  // A quad may join an earlier batch with the same texture only if nothing drawn after that batch overlaps it;
+  // otherwise it would end up beneath something it was previously drawn on top of.
+  RenderBatch* batch{nullptr};
+  for(auto batchIter = layer.batches.rbegin(); batchIter != layer.batches.rend(); ++batchIter) {
+    if(batchIter->texture == texture) {
+      batch = &(*batchIter);
+      break;
+    } // if batch uses the same texture
+    if(batchIter->bounds.findIntersection(bounds).has_value()) {
+      break;
+    } // if batch overlaps this quad
+  } // for each RenderBatch in reverse draw order
+  if(!batch) {
+    batch = &layer.batches.emplace_back(RenderBatch{
+      texture, ComponentHandle{}, sf::VertexArray{sf::PrimitiveType::Triangles}, bounds, 0
+    });
+  } // if no suitable batch exists
+  else {
+    const sf::Vector2f topLeft{
+      std::min(batch->bounds.position.x, bounds.position.x),
+      std::min(batch->bounds.position.y, bounds.position.y)
+    };
+    const sf::Vector2f bottomRight{
+      std::max(batch->bounds.position.x + batch->bounds.size.x, bounds.position.x + bounds.size.x),
+      std::max(batch->bounds.position.y + batch->bounds.size.y, bounds.position.y + bounds.size.y)
+    };
+    batch->bounds = sf::FloatRect{topLeft, bottomRight - topLeft};
+  } // else append to existing batch
+
+  // SFML 3 has no quad primitive, so each quad is two triangles
+  const sf::Vector2f topLeft{bounds.position};
+  const sf::Vector2f topRight{bounds.position.x + bounds.size.x, bounds.position.y};
+  const sf::Vector2f bottomLeft{bounds.position.x, bounds.position.y + bounds.size.y};
+  const sf::Vector2f bottomRight{bounds.position + bounds.size};
+  const sf::Vector2f texTopLeft{textureRect.position};
+  const sf::Vector2f texTopRight{textureRect.position.x + textureRect.size.x, textureRect.position.y};
+  const sf::Vector2f texBottomLeft{textureRect.position.x, textureRect.position.y + textureRect.size.y};
+  const sf::Vector2f texBottomRight{textureRect.position + textureRect.size};
+  batch->vertices.append(sf::Vertex{topLeft, sf::Color::White, texTopLeft});
+  batch->vertices.append(sf::Vertex{topRight, sf::Color::White, texTopRight});
+  batch->vertices.append(sf::Vertex{bottomLeft, sf::Color::White, texBottomLeft});
+  batch->vertices.append(sf::Vertex{bottomLeft, sf::Color::White, texBottomLeft});
+  batch->vertices.append(sf::Vertex{topRight, sf::Color::White, texTopRight});
+  batch->vertices.append(sf::Vertex{bottomRight, sf::Color::White, texBottomRight});
+  return *batch;
+}
+
+void farcical::engine::RenderSystem::AppendNineSlice(RenderLayer& layer, const RenderComponent& component) {
+  const NineSlice& nineSlice{component.nineSlice.value()};
+  const auto& getSize = [](const sf::Texture* texture) {
+    return texture ? sf::Vector2f{texture->getSize()} : sf::Vector2f{0.0f, 0.0f};
+  };
+  const sf::Vector2f topLeft{getSize(nineSlice.corners[static_cast<int>(Rectangle::Corner::TopLeft)])};
+  const sf::Vector2f topRight{getSize(nineSlice.corners[static_cast<int>(Rectangle::Corner::TopRight)])};
+  const sf::Vector2f bottomLeft{getSize(nineSlice.corners[static_cast<int>(Rectangle::Corner::BottomLeft)])};
+  const sf::Vector2f left{getSize(nineSlice.edges[static_cast<int>(Rectangle::Edge::Left)])};
+  const sf::Vector2f top{getSize(nineSlice.edges[static_cast<int>(Rectangle::Edge::Top)])};
+  const sf::Vector2f& size{nineSlice.size};
+
+  // The right-hand column is as wide as the top-right corner, the bottom row as tall as the bottom-left one.
+  // Horizontal edges are as tall as the top edge, vertical ones as wide as the left edge.
+  const float rightColumn{size.x - topRight.x};
+  const float bottomRow{size.y - bottomLeft.y};
+  const sf::Vector2f horizontalEdgeSize{size.x - topLeft.x - topRight.x, top.y};
+  const sf::Vector2f verticalEdgeSize{left.x, size.y - topLeft.y - bottomLeft.y};
+  const std::array<std::pair<sf::Texture*, sf::FloatRect>, 9> slices{{
+    {nineSlice.corners[static_cast<int>(Rectangle::Corner::TopLeft)], {{0.0f, 0.0f}, topLeft}},
+    {nineSlice.corners[static_cast<int>(Rectangle::Corner::TopRight)], {{rightColumn, 0.0f}, topRight}},
+    {nineSlice.corners[static_cast<int>(Rectangle::Corner::BottomLeft)], {{0.0f, bottomRow}, bottomLeft}},
+    {
+      nineSlice.corners[static_cast<int>(Rectangle::Corner::BottomRight)],
+      {{rightColumn, bottomRow}, getSize(nineSlice.corners[static_cast<int>(Rectangle::Corner::BottomRight)])}
+    },
+    {nineSlice.edges[static_cast<int>(Rectangle::Edge::Top)], {{topLeft.x, 0.0f}, horizontalEdgeSize}},
+    {
+      nineSlice.edges[static_cast<int>(Rectangle::Edge::Bottom)],
+      {{bottomLeft.x, size.y - horizontalEdgeSize.y}, horizontalEdgeSize}
+    },
+    {nineSlice.edges[static_cast<int>(Rectangle::Edge::Left)], {{0.0f, topLeft.y}, verticalEdgeSize}},
+    {nineSlice.edges[static_cast<int>(Rectangle::Edge::Right)], {{rightColumn, topRight.y}, verticalEdgeSize}},
+    {
+      nineSlice.center,
+      {{verticalEdgeSize.x, topLeft.y}, {size.x - 2.0f * verticalEdgeSize.x, size.y - 2.0f * horizontalEdgeSize.y}}
+    }
+  }};
+
+  // Every slice covers texels from its own top-left corner onwards; edges & center repeat to fill their quads
+  bool isFirstQuad{true};
+  for(const auto& [texture, area]: slices) {
+    if(!texture || area.size.x <= 0.0f || area.size.y <= 0.0f) {
+      continue;
+    } // if slice is missing or squeezed out
+    const sf::FloatRect bounds{
+      component.position + sf::Vector2f{area.position.x * component.scale.x, area.position.y * component.scale.y},
+      sf::Vector2f{area.size.x * component.scale.x, area.size.y * component.scale.y}
+    };
+    RenderBatch& batch{AppendQuad(layer, texture, bounds, sf::FloatRect{{0.0f, 0.0f}, area.size})};
+    // Counted once, so batches that only hold its other slices show up as draw calls batching couldn't save
+    if(isFirstQuad) {
+      ++batch.numComponents;
+      isFirstQuad = false;
+    } // if isFirstQuad
+  } // for each slice
+}
+
+void farcical::engine::RenderSystem::DrawBatches(sf::RenderTarget& target, const RenderLayer& layer) {
+  for(const auto& batch: layer.batches) {
+    if(batch.texture) {
+      target.draw(batch.vertices, sf::RenderStates{batch.texture});
+    } // if sprite batch
+    else if(RenderComponent* text = components.Get(batch.text)) {
+      target.draw(*text->GetText());
+    } // else if text batch
+    ++numDrawCalls;
+    numDrawCallsSaved += batch.numComponents - 1;
+  } // for each RenderBatch in RenderLayer
+}
+
+std::optional<farcical::engine::Error> farcical::engine::RenderSystem::UpdateLayerCache(RenderLayer& layer) {
+  FARCICAL_PROFILE_SCOPE("RenderSystem::UpdateLayerCache");
+  if(!layer.cache || layer.cache->getSize() != window.getSize()) {
+    layer.cache = std::make_unique<sf::RenderTexture>();
+    if(!layer.cache->resize(window.getSize())) {
+      layer.cache.reset();
+      const std::string failMsg{
+        "Error: Failed to create RenderTexture to cache RenderLayer " +
+        std::to_string(static_cast<int>(layer.id)) + "."
+      };
+      return Error{Error::Signal::InvalidConfiguration, failMsg};
+    } // if resize == failure
+  } // if cache must be (re)created
+
+  // Draw calls made offscreen are not part of what the window pays for each frame
+  const int windowDrawCalls{numDrawCalls};
+  const int windowDrawCallsSaved{numDrawCallsSaved};
+  layer.cache->clear(sf::Color::Transparent);
+  DrawBatches(*layer.cache, layer);
+  layer.cache->display();
+  numDrawCalls = windowDrawCalls;
+  numDrawCallsSaved = windowDrawCallsSaved;
+  return std::nullopt;
+}
@@ -9,11 +9,13 @@
 #include "../../include/ui/menu.hpp"
 #include "../../include/ui/decoration.hpp"
 #include "../../include/engine/system/log.hpp"
+#include "../../include/engine/profiler.hpp"
 #include "../../include/ui/factory.hpp"
 
 farcical::game::GameController::GameController(Game& game) : Entity(engine::EntityID{GameControllerID}),
                                                              EventHandler(),
-                                                             LogInterface(game.GetEngine().GetLogSystem()), game{game} {
+                                                             LogInterface(game.GetEngine().GetLogSystem(), "GameController"),
+                                                             game{game} {
 }
 
 void farcical::game::GameController::HandleEvent(const engine::Event& event) {
@@ -22,15 +24,15 @@ void farcical::game::GameController::HandleEvent(const engine::Event& event) {
     ui::Scene* currentScene{sceneManager.GetCurrentScene()};
 
     if(event.type == engine::Event::Type::NotifyErrorOccurred) {
-        WriteToLog("GameController received 'NotifyErrorOccurred' event.");
+        FARCICAL_LOG_DEBUG(*this, "GameController received 'NotifyErrorOccurred' event.");
         game.Stop();
     } else if(event.type == engine::Event::Type::QuitGame) {
-        WriteToLog("GameController received 'QuitGame' event.");
+        FARCICAL_LOG_DEBUG(*this, "GameController received 'QuitGame' event.");
         game.Stop();
     } // if event.type == QuitGame
 
     else if(event.type == engine::Event::Type::ApplyEngineConfig) {
-        WriteToLog("GameController received 'ApplyEngineConfig' event.");
+        FARCICAL_LOG_DEBUG(*this, "GameController received 'ApplyEngineConfig' event.");
         //const auto& createConfig{game.GetEngine().CreateConfig()};
         //engine::Config config{createConfig.value()};
         engine::Config currentConfig{game.GetEngine().GetConfig()};
@@ -42,12 +44,11 @@ void farcical::game::GameController::HandleEvent(const engine::Event& event) {
             ui::Menu* menu{dynamic_cast<ui::Menu*>(displayOptionsWidget)};
             ui::Widget* focusedWidget{currentScene->GetFocusedWidget()};
             if(focusedWidget) {
-                engine::EntityID focusedWidgetID{focusedWidget->GetID()};
+                const std::string& focusedWidgetName{focusedWidget->GetID().GetName()};
                 const std::string radioButtonString{"RadioButton"};
-                engine::EntityID labelID{
-                    focusedWidgetID.substr(0, focusedWidgetID.length() - radioButtonString.length())
+                const engine::EntityID labelID{
+                    focusedWidgetName.substr(0, focusedWidgetName.length() - radioButtonString.length()) + "Label"
                 };
-                labelID += "Label";
                 ui::Text* radioButtonLabel{dynamic_cast<ui::Text*>(menu->FindChild(labelID))};
                 if(radioButtonLabel) {
                     const std::string contents{radioButtonLabel->GetContents()};
@@ -69,24 +70,21 @@ void farcical::game::GameController::HandleEvent(const engine::Event& event) {
     } // else if event.type == ApplyEngineConfig
 
     else if(event.type == engine::Event::Type::CreateScene) {
-        std::string logMsg{"GameController received 'CreateScene' event (args=\""};
-        for(const auto& arg: event.args) {
-            if(arg.type() == typeid(std::string)) {
-                const std::string argString{std::any_cast<std::string>(arg)};
-                logMsg.append(argString);
-            } // string
-        } // for each arg
-        logMsg.append("\").");
-        WriteToLog(logMsg);
-        const engine::EntityID nextSceneID{std::any_cast<std::string>(event.args.at(0))};
-
-        const auto& destroyCurrentScene{sceneManager.DestroyCurrentScene()};
-        if(!destroyCurrentScene.has_value()) {
-            const auto& createNextScene{sceneManager.SetCurrentScene(nextSceneID)};
-            if(!createNextScene.has_value()) {
-                game.Stop();
-            } // if createNextScene == failure
-        } // if destroyCurrentScene == success
+        const std::string& nextSceneName{std::any_cast<const std::string&>(event.args.at(0))};
+        FARCICAL_LOG_DEBUG(*this, "GameController received 'CreateScene' event (args=\"{}\").", nextSceneName);
+        // Every Scene in the SceneIndex was interned when the index was loaded, so a name that wasn't can't be one
+        const auto& findNextScene{engine::EntityID::Find(nextSceneName)};
+        if(!findNextScene.has_value()) {
+            LogError("Scene (id=\"{}\") not found.", nextSceneName);
+            game.Stop();
+            return;
+        } // if nextSceneName was never interned
+
+        // The current Scene stays up until SceneManager::Update finds everything the next one needs loaded
+        const auto& requestNextScene{sceneManager.RequestScene(findNextScene.value())};
+        if(requestNextScene.has_value()) {
+            game.Stop();
+        } // if requestNextScene == failure
     } // else if event.type == CreateScene
 }
 
@@ -105,23 +103,23 @@ farcical::engine::Engine& farcical::game::Game::GetEngine() const {
 }
 
 std::optional<farcical::engine::Error> farcical::game::Game::Init() {
-    engine::LogSystem& logSystem{engine.GetLogSystem()};
+    const engine::LogInterface log{engine.GetLogSystem(), "Game"};
     if(status == Status::IsRunning) {
-        logSystem.AddMessage("Error: Game.Init() called, but Game is already initialized!");
+        log.LogWarning("Game.Init() called, but Game is already initialized!");
     } else if(status == Status::Error) {
-        logSystem.AddMessage("Unknown error occurred in game.Init() [game.status == Error]");
+        log.LogError("Unknown error occurred in game.Init() [game.status == Error]");
     }
     if(status == Status::IsRunning || status == Status::Error) {
         return std::nullopt;
     } // if status == IsRunning || Error
-    logSystem.AddMessage("Initializing game...");
+    log.LogInfo("Initializing game...");
 
 
-    logSystem.AddMessage("Creating GameController...");
+    FARCICAL_LOG_DEBUG(log, "Creating GameController...");
     controller = std::make_unique<GameController>(*this);
 
     // Subscribe GameController to QuitGame, CreateScene, DestroyScene Events
-    logSystem.AddMessage("Registering EventHandlers...");
+    FARCICAL_LOG_DEBUG(log, "Registering EventHandlers...");
     engine::EventSystem& eventSystem{engine.GetEventSystem()};
     const std::vector<engine::Event::Type> handledTypes{
         engine::Event::Type::NotifyErrorOccurred,
@@ -143,9 +141,15 @@ std::optional<farcical::engine::Error> farcical::game::Game::Init() {
 }
 
 std::optional<farcical::engine::Error> farcical::game::Game::Update() {
+    FARCICAL_PROFILE_SCOPE("Game::Update");
     return std::nullopt;
 }
 
+bool farcical::game::Game::IsSimulating() const {
+    // Nothing in the game changes between inputs yet
+    return false;
+}
+
 std::optional<farcical::engine::Error> farcical::game::Game::Stop() {
     if(status == Status::IsRunning) {
         if(controller) {
@@ -0,0 +1,272 @@
+//
+// Created by dgmuller on 9/15/25.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <utility>
+#include "../../include/resource/assetPack.hpp"
+#include "../../include/engine/hash.hpp"
+#include "../../include/engine/profiler.hpp"
+
+namespace {
+    std::optional<std::string> ReadWholeFile(const std::string& path) {
+        std::ifstream input{path, std::ios_base::in | std::ios_base::binary};
+        if(!input.is_open()) {
+            return std::nullopt;
+        } // if file could not be opened
+        return std::string{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+    }
+
+    std::uint64_t AlignUp(std::uint64_t offset) {
+        const std::uint64_t alignment{farcical::AssetPack::BlobAlignment};
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    // One file on its way into the pack
+    struct PackedFile {
+        std::string sourcePath;
+        std::string path;
+        std::uint64_t size;
+        std::uint64_t contentHash;
+        // Index of the first file with the same contents; its blob is shared
+        std::size_t blobIndex;
+        std::uint64_t offset;
+    };
+}
+
+std::optional<farcical::engine::Error> farcical::AssetPack::Open(std::string_view path) {
+    FARCICAL_PROFILE_SCOPE("AssetPack::Open");
+    Close();
+    const std::string pathString{path};
+    const auto& openFile{mappedFile.Open(path, engine::MappedFile::Mode::ReadOnly)};
+    if(openFile.has_value()) {
+        return openFile;
+    } // if openFile == failure
+    const std::byte* data{mappedFile.GetData()};
+    const std::size_t size{mappedFile.GetSize()};
+
+    Header header;
+    if(size < sizeof(Header)) {
+        Close();
+        const std::string failMsg{"AssetPack " + pathString + " is truncated."};
+        return engine::Error{engine::Error::Signal::UnexpectedValue, failMsg};
+    } // if file is too short to hold a Header
+    std::memcpy(&header, data, sizeof(Header));
+    if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version) {
+        Close();
+        const std::string failMsg{"AssetPack " + pathString + " is not a pack, or is from another version."};
+        return engine::Error{engine::Error::Signal::UnexpectedValue, failMsg};
+    } // if magic or version do not match
+    const std::uint64_t indexSize{static_cast<std::uint64_t>(header.numEntries) * sizeof(Entry)};
+    if(indexSize > size - sizeof(Header)
+       || header.pathsOffset < sizeof(Header) + indexSize
+       || header.pathsOffset > size
+       || header.pathsSize > size - header.pathsOffset) {
+        Close();
+        const std::string failMsg{"AssetPack " + pathString + " has a corrupt index."};
+        return engine::Error{engine::Error::Signal::UnexpectedValue, failMsg};
+    } // if index or paths run past the end of the file
+
+    entries.resize(header.numEntries);
+    std::memcpy(entries.data(), data + sizeof(Header), indexSize);
+    paths = std::string_view{reinterpret_cast<const char*>(data + header.pathsOffset), header.pathsSize};
+    // Checked once here, so Find never has to
+    for(std::size_t index = 0; index < entries.size(); ++index) {
+        const Entry& entry{entries[index]};
+        const bool isInBounds{
+            entry.pathOffset <= paths.size() && entry.pathLength <= paths.size() - entry.pathOffset
+            && entry.offset <= size && entry.size <= size - entry.offset
+        };
+        if(!isInBounds || (index > 0 && GetPath(entries[index - 1]) >= GetPath(entry))) {
+            Close();
+            const std::string failMsg{"AssetPack " + pathString + " has a corrupt index."};
+            return engine::Error{engine::Error::Signal::UnexpectedValue, failMsg};
+        } // if entry is out of bounds or out of order
+    } // for each entry
+    return std::nullopt;
+}
+
+void farcical::AssetPack::Close() {
+    entries.clear();
+    paths = std::string_view{};
+    mappedFile.Close();
+}
+
+bool farcical::AssetPack::IsOpen() const {
+    return mappedFile.IsOpen();
+}
+
+std::optional<std::span<const std::byte>> farcical::AssetPack::Find(std::string_view path) const {
+    const Entry* entry{FindEntry(NormalizePath(path))};
+    if(!entry) {
+        return std::nullopt;
+    } // if path is not packed
+    return std::span<const std::byte>{mappedFile.GetData() + entry->offset, entry->size};
+}
+
+std::optional<farcical::engine::Error> farcical::AssetPack::Verify(std::string_view path) const {
+    const Entry* entry{FindEntry(NormalizePath(path))};
+    if(!entry) {
+        const std::string failMsg{"Resource not found: " + std::string{path} + " is not in the AssetPack."};
+        return engine::Error{engine::Error::Signal::ResourceNotFound, failMsg};
+    } // if path is not packed
+    const std::string_view contents{reinterpret_cast<const char*>(mappedFile.GetData() + entry->offset), entry->size};
+    if(engine::HashBytes(contents) != entry->contentHash) {
+        const std::string failMsg{"AssetPack entry for " + std::string{path} + " is corrupt."};
+        return engine::Error{engine::Error::Signal::UnexpectedValue, failMsg};
+    } // if contents changed since they were packed
+    return std::nullopt;
+}
+
+std::size_t farcical::AssetPack::GetNumEntries() const {
+    return entries.size();
+}
+
+std::vector<std::string_view> farcical::AssetPack::GetPaths() const {
+    std::vector<std::string_view> packedPaths;
+    packedPaths.reserve(entries.size());
+    for(const auto& entry: entries) {
+        packedPaths.push_back(GetPath(entry));
+    } // for each entry
+    return packedPaths;
+}
+
+std::optional<farcical::engine::Error> farcical::AssetPack::Build(std::string_view outputPath,
+                                                                const std::vector<std::string>& files) {
+    FARCICAL_PROFILE_SCOPE("AssetPack::Build");
+    std::vector<PackedFile> packedFiles;
+    packedFiles.reserve(files.size());
+    for(const auto& file: files) {
+        packedFiles.push_back(PackedFile{file, NormalizePath(file), 0, 0, 0, 0});
+    } // for each file
+    std::sort(packedFiles.begin(), packedFiles.end(), [](const PackedFile& lhs, const PackedFile& rhs) {
+        return lhs.path < rhs.path;
+    });
+    const auto& findDuplicate{
+        std::adjacent_find(packedFiles.begin(), packedFiles.end(), [](const PackedFile& lhs, const PackedFile& rhs) {
+            return lhs.path == rhs.path;
+        })
+    };
+    if(findDuplicate != packedFiles.end()) {
+        const std::string failMsg{"Invalid configuration: " + findDuplicate->path + " would be packed twice."};
+        return engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg};
+    } // if two files share a path
+
+    // Hash everything first, so the index can be written before any blob
+    std::map<std::pair<std::uint64_t, std::uint64_t>, std::size_t> blobs;
+    for(std::size_t index = 0; index < packedFiles.size(); ++index) {
+        PackedFile& packedFile{packedFiles[index]};
+        const auto& readFile{ReadWholeFile(packedFile.sourcePath)};
+        if(!readFile.has_value()) {
+            const std::string failMsg{"Invalid path: Could not read " + packedFile.sourcePath + "."};
+            return engine::Error{engine::Error::Signal::InvalidPath, failMsg};
+        } // if file could not be read
+        packedFile.size = readFile.value().size();
+        packedFile.contentHash = engine::HashBytes(readFile.value());
+        packedFile.blobIndex = index;
+        const auto& findBlob{blobs.find({packedFile.contentHash, packedFile.size})};
+        if(findBlob == blobs.end()) {
+            blobs.emplace(std::pair{packedFile.contentHash, packedFile.size}, index);
+        } // if these contents are new
+        else if(ReadWholeFile(packedFiles[findBlob->second].sourcePath) == readFile) {
+            packedFile.blobIndex = findBlob->second;
+        } // else if they really are the same (not just the same hash)
+    } // for each file
+
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.numEntries = static_cast<std::uint32_t>(packedFiles.size());
+    header.pathsOffset = sizeof(Header) + packedFiles.size() * sizeof(Entry);
+    std::string packedPaths;
+    std::vector<Entry> packedEntries;
+    packedEntries.reserve(packedFiles.size());
+    for(const auto& packedFile: packedFiles) {
+        packedEntries.push_back(Entry{0, packedFile.size, packedFile.contentHash,
+                                      static_cast<std::uint32_t>(packedPaths.size()),
+                                      static_cast<std::uint32_t>(packedFile.path.size())});
+        packedPaths += packedFile.path;
+    } // for each file
+    header.pathsSize = packedPaths.size();
+    std::uint64_t offset{header.pathsOffset + header.pathsSize};
+    for(std::size_t index = 0; index < packedFiles.size(); ++index) {
+        PackedFile& packedFile{packedFiles[index]};
+        if(packedFile.blobIndex == index) {
+            offset = AlignUp(offset);
+            packedFile.offset = offset;
+            offset += packedFile.size;
+        } // if this file owns its blob
+        else {
+            packedFile.offset = packedFiles[packedFile.blobIndex].offset;
+        } // else share the earlier one
+        packedEntries[index].offset = packedFile.offset;
+    } // for each file
+
+    // Written aside and renamed into place, so a running game never maps half a pack
+    const std::filesystem::path packPath{outputPath};
+    std::filesystem::path tempPath{packPath};
+    tempPath += ".tmp";
+    {
+        std::ofstream output{tempPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+        output.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        output.write(reinterpret_cast<const char*>(packedEntries.data()),
+                     static_cast<std::streamsize>(packedEntries.size() * sizeof(Entry)));
+        output.write(packedPaths.data(), static_cast<std::streamsize>(packedPaths.size()));
+        std::uint64_t written{header.pathsOffset + header.pathsSize};
+        for(std::size_t index = 0; index < packedFiles.size() && output.good(); ++index) {
+            const PackedFile& packedFile{packedFiles[index]};
+            if(packedFile.blobIndex != index) {
+                continue;
+            } // if contents were already written
+            const std::string padding(packedFile.offset - written, '\0');
+            output.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+            const auto& readFile{ReadWholeFile(packedFile.sourcePath)};
+            if(!readFile.has_value() || readFile.value().size() != packedFile.size) {
+                output.setstate(std::ios_base::failbit);
+                break;
+            } // if file changed while it was being packed
+            output.write(readFile.value().data(), static_cast<std::streamsize>(readFile.value().size()));
+            written = packedFile.offset + packedFile.size;
+        } // for each file
+        if(!output.good()) {
+            output.close();
+            std::error_code errorCode;
+            std::filesystem::remove(tempPath, errorCode);
+            const std::string failMsg{"Could not write AssetPack " + tempPath.string() + "."};
+            return engine::Error{engine::Error::Signal::WriteFailure, failMsg};
+        } // if pack could not be written
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(tempPath, packPath, errorCode);
+    if(errorCode) {
+        std::filesystem::remove(tempPath, errorCode);
+        const std::string failMsg{"Could not write AssetPack " + packPath.string() + "."};
+        return engine::Error{engine::Error::Signal::WriteFailure, failMsg};
+    } // if pack could not be moved into place
+    return std::nullopt;
+}
+
+std::string farcical::AssetPack::NormalizePath(std::string_view path) {
+    return std::filesystem::path{path}.lexically_normal().generic_string();
+}
+
+const farcical::AssetPack::Entry* farcical::AssetPack::FindEntry(std::string_view normalizedPath) const {
+    const auto& findEntry{
+        std::lower_bound(entries.begin(), entries.end(), normalizedPath, [this](const Entry& entry, std::string_view path) {
+            return GetPath(entry) < path;
+        })
+    };
+    if(findEntry == entries.end() || GetPath(*findEntry) != normalizedPath) {
+        return nullptr;
+    } // if path is not packed
+    return &*findEntry;
+}
+
+std::string_view farcical::AssetPack::GetPath(const Entry& entry) const {
+    return paths.substr(entry.pathOffset, entry.pathLength);
+}
@@ -0,0 +1,170 @@
+//
+// Created by dgmuller on 9/17/25.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <vector>
+#include "../../include/resource/compositeCache.hpp"
+#include "../../include/engine/mappedFile.hpp"
+#include "../../include/engine/profiler.hpp"
+
+farcical::CompositeCache::CompositeCache(std::string_view directory, std::uintmax_t maxSize) : directory{directory},
+    maxSize{maxSize},
+    statistics{} {
+}
+
+bool farcical::CompositeCache::IsEnabled() const {
+    return !directory.empty();
+}
+
+std::expected<sf::Texture, farcical::engine::Error> farcical::CompositeCache::Read(std::uint64_t key) {
+    FARCICAL_PROFILE_SCOPE("CompositeCache::Read");
+    const std::filesystem::path entryPath{GetEntryPath(key)};
+    std::error_code errorCode;
+    if(!std::filesystem::exists(entryPath, errorCode)) {
+        ++statistics.numMisses;
+        const std::string failMsg{std::format("No CompositeCache entry for {:016x}.", key)};
+        return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
+    } // if there is no entry
+    engine::MappedFile entry;
+    const auto& openEntry{entry.Open(entryPath.string(), engine::MappedFile::Mode::ReadOnly)};
+    if(openEntry.has_value()) {
+        ++statistics.numMisses;
+        return std::unexpected(openEntry.value());
+    } // if openEntry == failure
+
+    Header header;
+    if(entry.GetSize() < sizeof(Header)) {
+        ++statistics.numMisses;
+        const std::string failMsg{std::format("CompositeCache entry {} is truncated.", entryPath.string())};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if entry is too short to hold a Header
+    std::memcpy(&header, entry.GetData(), sizeof(Header));
+    if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version || header.key != key) {
+        ++statistics.numMisses;
+        const std::string failMsg{std::format("CompositeCache entry {} is from another version.", entryPath.string())};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if magic, version or key do not match
+    const std::uint64_t numPixelBytes{static_cast<std::uint64_t>(header.width) * header.height * 4};
+    if(header.width == 0 || header.height == 0 || entry.GetSize() - sizeof(Header) != numPixelBytes) {
+        ++statistics.numMisses;
+        const std::string failMsg{std::format("CompositeCache entry {} is corrupt.", entryPath.string())};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if pixels do not fill the entry exactly
+
+    sf::Texture texture;
+    if(!texture.resize(sf::Vector2u{header.width, header.height})) {
+        ++statistics.numMisses;
+        const std::string failMsg{std::format("Could not create {}x{} Texture.", header.width, header.height)};
+        return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
+    } // if texture could not be created
+    texture.update(reinterpret_cast<const std::uint8_t*>(entry.GetData() + sizeof(Header)));
+    // An entry's modification time is when it was last used, so eviction can find the least recently used
+    std::filesystem::last_write_time(entryPath, std::filesystem::file_time_type::clock::now(), errorCode);
+    ++statistics.numHits;
+    return texture;
+}
+
+std::optional<farcical::engine::Error> farcical::CompositeCache::Write(std::uint64_t key,
+                                                                       const sf::Vector2u& imageSize,
+                                                                       const std::uint8_t* pixels) {
+    FARCICAL_PROFILE_SCOPE("CompositeCache::Write");
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.key = key;
+    header.version = Version;
+    header.width = imageSize.x;
+    header.height = imageSize.y;
+    const std::uintmax_t entrySize{sizeof(Header) + static_cast<std::uintmax_t>(imageSize.x) * imageSize.y * 4};
+    if(entrySize > maxSize) {
+        const std::string failMsg{
+            std::format("{}x{} Texture is too big for CompositeCache.", imageSize.x, imageSize.y)
+        };
+        return engine::Error{engine::Error::Signal::UnexpectedValue, failMsg};
+    } // if entry could never fit
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(directory, errorCode);
+    if(!size.has_value()) {
+        size = 0;
+        for(const auto& directoryEntry: std::filesystem::directory_iterator{directory, errorCode}) {
+            if(directoryEntry.path().extension() == ".composite") {
+                size.value() += directoryEntry.file_size(errorCode);
+            } // if directoryEntry is a cache entry
+        } // for each file in directory
+    } // if size hasn't been measured yet
+
+    // Written aside and renamed into place, so a reader never sees half an entry
+    const std::filesystem::path entryPath{GetEntryPath(key)};
+    std::filesystem::path tempPath{entryPath};
+    tempPath += ".tmp";
+    {
+        std::ofstream output{tempPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+        if(!output.is_open()
+           || !output.write(reinterpret_cast<const char*>(&header), sizeof(Header))
+           || !output.write(reinterpret_cast<const char*>(pixels),
+                            static_cast<std::streamsize>(entrySize - sizeof(Header)))) {
+            const std::string failMsg{"Could not write CompositeCache entry " + tempPath.string() + "."};
+            return engine::Error{engine::Error::Signal::WriteFailure, failMsg};
+        } // if entry could not be written
+    }
+    const std::uintmax_t replacedSize{std::filesystem::exists(entryPath, errorCode)
+                                          ? std::filesystem::file_size(entryPath, errorCode)
+                                          : 0};
+    std::filesystem::rename(tempPath, entryPath, errorCode);
+    if(errorCode) {
+        std::filesystem::remove(tempPath, errorCode);
+        const std::string failMsg{"Could not write CompositeCache entry " + entryPath.string() + "."};
+        return engine::Error{engine::Error::Signal::WriteFailure, failMsg};
+    } // if entry could not be moved into place
+    ++statistics.numWrites;
+    size = size.value() - std::min(replacedSize, size.value()) + entrySize;
+    if(size.value() > maxSize) {
+        Evict();
+    } // if cache has grown too big
+    return std::nullopt;
+}
+
+const farcical::CompositeCache::Statistics& farcical::CompositeCache::GetStatistics() const {
+    return statistics;
+}
+
+std::filesystem::path farcical::CompositeCache::GetEntryPath(std::uint64_t key) const {
+    return directory / std::format("{:016x}.composite", key);
+}
+
+void farcical::CompositeCache::Evict() {
+    FARCICAL_PROFILE_SCOPE("CompositeCache::Evict");
+    struct EntryFile {
+        std::filesystem::path path;
+        std::filesystem::file_time_type lastUsed;
+        std::uintmax_t size;
+    };
+    std::vector<EntryFile> entryFiles;
+    std::uintmax_t totalSize{0};
+    std::error_code errorCode;
+    for(const auto& directoryEntry: std::filesystem::directory_iterator{directory, errorCode}) {
+        if(directoryEntry.path().extension() != ".composite") {
+            continue;
+        } // if directoryEntry is not a cache entry
+        const EntryFile& entryFile{
+            entryFiles.emplace_back(directoryEntry.path(), directoryEntry.last_write_time(errorCode),
+                                    directoryEntry.file_size(errorCode))
+        };
+        totalSize += entryFile.size;
+    } // for each file in directory
+    std::ranges::sort(entryFiles, {}, &EntryFile::lastUsed);
+    for(const auto& entryFile: entryFiles) {
+        if(totalSize <= maxSize) {
+            break;
+        } // if what's left fits
+        if(std::filesystem::remove(entryFile.path, errorCode)) {
+            totalSize -= entryFile.size;
+            ++statistics.numEvictions;
+        } // if entryFile was deleted
+    } // for each entry, least recently used first
+    size = totalSize;
+}
@@ -0,0 +1,385 @@
+//
+// Created by dgmuller on 9/18/25.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include "../../include/resource/compositor.hpp"
+#include "../../include/engine/profiler.hpp"
+#include "../../include/geometry.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FARCICAL_COMPOSITOR_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define FARCICAL_TARGET_AVX2
+#else
+#define FARCICAL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace {
+    using InstructionSet = farcical::Compositor::InstructionSet;
+
+    // round(value / 255) for any value up to 255 * 255, without dividing; the SIMD kernels do the same in 16 bits
+    std::uint8_t Divide255(std::uint32_t value) {
+        value += 128;
+        return static_cast<std::uint8_t>((value + (value >> 8)) >> 8);
+    }
+
+    void ScaleAlphaScalar(std::uint8_t* pixels, std::size_t numPixels, std::uint8_t factor) {
+        for(std::size_t index = 0; index < numPixels; ++index) {
+            pixels[index * 4 + 3] = Divide255(pixels[index * 4 + 3] * factor);
+        } // for each pixel
+    }
+
+    // destination = source * sourceAlpha + destination * (1 - sourceAlpha), with alpha itself weighted by 1
+    void BlendScalar(std::uint8_t* destination, const std::uint8_t* source, std::size_t numPixels) {
+        for(std::size_t index = 0; index < numPixels * 4; index += 4) {
+            const std::uint32_t sourceAlpha{source[index + 3]};
+            const std::uint32_t inverseAlpha{255 - sourceAlpha};
+            for(int channel = 0; channel < 3; ++channel) {
+                destination[index + channel] = Divide255(
+                    source[index + channel] * sourceAlpha + destination[index + channel] * inverseAlpha);
+            } // for each color channel
+            destination[index + 3] = Divide255(255 * sourceAlpha + destination[index + 3] * inverseAlpha);
+        } // for each pixel
+    }
+
+#ifdef FARCICAL_COMPOSITOR_X86
+    // The 16-bit lanes hold at most 255 * 255, so the unsigned arithmetic never wraps
+    __m128i Divide255(__m128i values) {
+        const __m128i rounded{_mm_add_epi16(values, _mm_set1_epi16(128))};
+        return _mm_srli_epi16(_mm_add_epi16(rounded, _mm_srli_epi16(rounded, 8)), 8);
+    }
+
+    void ScaleAlphaSSE2(std::uint8_t* pixels, std::size_t numPixels, std::uint8_t factor) {
+        const __m128i factors{_mm_set1_epi32(factor)};
+        const __m128i colorMask{_mm_set1_epi32(0x00FFFFFF)};
+        std::size_t index{0};
+        for(; index + 4 <= numPixels; index += 4) {
+            auto* address{reinterpret_cast<__m128i*>(pixels + index * 4)};
+            const __m128i fourPixels{_mm_loadu_si128(address)};
+            const __m128i alpha{Divide255(_mm_mullo_epi16(_mm_srli_epi32(fourPixels, 24), factors))};
+            _mm_storeu_si128(address, _mm_or_si128(_mm_and_si128(fourPixels, colorMask), _mm_slli_epi32(alpha, 24)));
+        } // for each 4 pixels
+        ScaleAlphaScalar(pixels + index * 4, numPixels - index, factor);
+    }
+
+    // Blend two pixels widened to 16 bits per channel
+    __m128i BlendWide(__m128i source, __m128i destination) {
+        const __m128i alpha{
+            _mm_shufflehi_epi16(_mm_shufflelo_epi16(source, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3))
+        };
+        const __m128i sourceFactors{
+            _mm_or_si128(_mm_and_si128(alpha, _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1)),
+                         _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0))
+        };
+        const __m128i destinationFactors{_mm_sub_epi16(_mm_set1_epi16(255), alpha)};
+        return Divide255(_mm_add_epi16(_mm_mullo_epi16(source, sourceFactors),
+                                       _mm_mullo_epi16(destination, destinationFactors)));
+    }
+
+    void BlendSSE2(std::uint8_t* destination, const std::uint8_t* source, std::size_t numPixels) {
+        const __m128i zero{_mm_setzero_si128()};
+        std::size_t index{0};
+        for(; index + 4 <= numPixels; index += 4) {
+            auto* destinationAddress{reinterpret_cast<__m128i*>(destination + index * 4)};
+            const __m128i sourcePixels{_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + index * 4))};
+            const __m128i destinationPixels{_mm_loadu_si128(destinationAddress)};
+            const __m128i low{
+                BlendWide(_mm_unpacklo_epi8(sourcePixels, zero), _mm_unpacklo_epi8(destinationPixels, zero))
+            };
+            const __m128i high{
+                BlendWide(_mm_unpackhi_epi8(sourcePixels, zero), _mm_unpackhi_epi8(destinationPixels, zero))
+            };
+            _mm_storeu_si128(destinationAddress, _mm_packus_epi16(low, high));
+        } // for each 4 pixels
+        BlendScalar(destination + index * 4, source + index * 4, numPixels - index);
+    }
+
+    FARCICAL_TARGET_AVX2 __m256i Divide255(__m256i values) {
+        const __m256i rounded{_mm256_add_epi16(values, _mm256_set1_epi16(128))};
+        return _mm256_srli_epi16(_mm256_add_epi16(rounded, _mm256_srli_epi16(rounded, 8)), 8);
+    }
+
+    FARCICAL_TARGET_AVX2 void ScaleAlphaAVX2(std::uint8_t* pixels, std::size_t numPixels, std::uint8_t factor) {
+        const __m256i factors{_mm256_set1_epi32(factor)};
+        const __m256i colorMask{_mm256_set1_epi32(0x00FFFFFF)};
+        std::size_t index{0};
+        for(; index + 8 <= numPixels; index += 8) {
+            auto* address{reinterpret_cast<__m256i*>(pixels + index * 4)};
+            const __m256i eightPixels{_mm256_loadu_si256(address)};
+            const __m256i alpha{Divide255(_mm256_mullo_epi16(_mm256_srli_epi32(eightPixels, 24), factors))};
+            _mm256_storeu_si256(address, _mm256_or_si256(_mm256_and_si256(eightPixels, colorMask),
+                                                         _mm256_slli_epi32(alpha, 24)));
+        } // for each 8 pixels
+        ScaleAlphaSSE2(pixels + index * 4, numPixels - index, factor);
+    }
+
+    FARCICAL_TARGET_AVX2 __m256i BlendWide(__m256i source, __m256i destination) {
+        const __m256i alpha{
+            _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(source, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3))
+        };
+        const __m256i sourceFactors{
+            _mm256_or_si256(
+                _mm256_and_si256(alpha, _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1)),
+                _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0))
+        };
+        const __m256i destinationFactors{_mm256_sub_epi16(_mm256_set1_epi16(255), alpha)};
+        return Divide255(_mm256_add_epi16(_mm256_mullo_epi16(source, sourceFactors),
+                                          _mm256_mullo_epi16(destination, destinationFactors)));
+    }
+
+    // Unpacking & packing both work within each 128-bit half, so the pixels come back out in order
+    FARCICAL_TARGET_AVX2 void BlendAVX2(std::uint8_t* destination, const std::uint8_t* source, std::size_t numPixels) {
+        const __m256i zero{_mm256_setzero_si256()};
+        std::size_t index{0};
+        for(; index + 8 <= numPixels; index += 8) {
+            auto* destinationAddress{reinterpret_cast<__m256i*>(destination + index * 4)};
+            const __m256i sourcePixels{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + index * 4))};
+            const __m256i destinationPixels{_mm256_loadu_si256(destinationAddress)};
+            const __m256i low{
+                BlendWide(_mm256_unpacklo_epi8(sourcePixels, zero), _mm256_unpacklo_epi8(destinationPixels, zero))
+            };
+            const __m256i high{
+                BlendWide(_mm256_unpackhi_epi8(sourcePixels, zero), _mm256_unpackhi_epi8(destinationPixels, zero))
+            };
+            _mm256_storeu_si256(destinationAddress, _mm256_packus_epi16(low, high));
+        } // for each 8 pixels
+        BlendSSE2(destination + index * 4, source + index * 4, numPixels - index);
+    }
+
+    bool HasAVX2() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if(info[0] < 7) {
+            return false;
+        } // if the CPU can't report AVX2
+        __cpuid(info, 1);
+        const bool hasOSXSave{(info[2] & (1 << 27)) != 0};
+        // The OS has to save the YMM registers, too
+        if(!hasOSXSave || (_xgetbv(0) & 0x6) != 0x6) {
+            return false;
+        } // if the OS doesn't support AVX
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    InstructionSet DetectInstructionSet() {
+#ifdef FARCICAL_COMPOSITOR_X86
+        return HasAVX2() ? InstructionSet::AVX2 : InstructionSet::SSE2;
+#else
+        return InstructionSet::Scalar;
+#endif
+    }
+
+    std::atomic<InstructionSet>& ActiveInstructionSet() {
+        static std::atomic<InstructionSet> instructionSet{DetectInstructionSet()};
+        return instructionSet;
+    }
+
+    void ScaleAlphaPixels(std::uint8_t* pixels, std::size_t numPixels, std::uint8_t factor) {
+        switch(ActiveInstructionSet().load(std::memory_order_relaxed)) {
+#ifdef FARCICAL_COMPOSITOR_X86
+            case InstructionSet::AVX2: {
+                ScaleAlphaAVX2(pixels, numPixels, factor);
+            }
+            break;
+            case InstructionSet::SSE2: {
+                ScaleAlphaSSE2(pixels, numPixels, factor);
+            }
+            break;
+#endif
+            default: {
+                ScaleAlphaScalar(pixels, numPixels, factor);
+            }
+        } // switch instructionSet
+    }
+
+    void BlendPixels(std::uint8_t* destination, const std::uint8_t* source, std::size_t numPixels) {
+        switch(ActiveInstructionSet().load(std::memory_order_relaxed)) {
+#ifdef FARCICAL_COMPOSITOR_X86
+            case InstructionSet::AVX2: {
+                BlendAVX2(destination, source, numPixels);
+            }
+            break;
+            case InstructionSet::SSE2: {
+                BlendSSE2(destination, source, numPixels);
+            }
+            break;
+#endif
+            default: {
+                BlendScalar(destination, source, numPixels);
+            }
+        } // switch instructionSet
+    }
+
+    // The part of a source placed at position that lands on a canvas of canvasSize
+    struct Clip {
+        sf::Vector2u source;
+        sf::Vector2u destination;
+        sf::Vector2u size;
+    };
+
+    Clip ClipTo(const sf::Vector2u& canvasSize, const sf::Vector2u& sourceSize, const sf::Vector2i& position) {
+        const long long left{std::max<long long>(position.x, 0)};
+        const long long top{std::max<long long>(position.y, 0)};
+        const long long right{std::min<long long>(static_cast<long long>(position.x) + sourceSize.x, canvasSize.x)};
+        const long long bottom{std::min<long long>(static_cast<long long>(position.y) + sourceSize.y, canvasSize.y)};
+        if(right <= left || bottom <= top) {
+            return Clip{{0, 0}, {0, 0}, {0, 0}};
+        } // if nothing lands on the canvas
+        return Clip{
+            {static_cast<unsigned int>(left - position.x), static_cast<unsigned int>(top - position.y)},
+            {static_cast<unsigned int>(left), static_cast<unsigned int>(top)},
+            {static_cast<unsigned int>(right - left), static_cast<unsigned int>(bottom - top)}
+        };
+    }
+}
+
+farcical::Compositor::View farcical::Compositor::ViewOf(const sf::Image& image) {
+    return View{image.getPixelsPtr(), image.getSize()};
+}
+
+farcical::Compositor::Compositor(const sf::Vector2u& size) : size{size},
+                                                             pixels(static_cast<std::size_t>(size.x) * size.y * 4, 0) {
+}
+
+const sf::Vector2u& farcical::Compositor::GetSize() const {
+    return size;
+}
+
+farcical::Compositor::View farcical::Compositor::GetView() const {
+    return View{pixels.data(), size};
+}
+
+void farcical::Compositor::Blit(const View& source, const sf::Vector2i& position) {
+    const Clip clip{ClipTo(size, source.size, position)};
+    for(unsigned int row = 0; row < clip.size.y; ++row) {
+        std::memcpy(pixels.data() + ((static_cast<std::size_t>(clip.destination.y) + row) * size.x
+                                     + clip.destination.x) * 4,
+                    source.pixels + ((static_cast<std::size_t>(clip.source.y) + row) * source.size.x
+                                     + clip.source.x) * 4,
+                    static_cast<std::size_t>(clip.size.x) * 4);
+    } // for each row
+}
+
+void farcical::Compositor::Tile(const View& source, const sf::IntRect& area) {
+    FARCICAL_PROFILE_SCOPE("Compositor::Tile");
+    if(source.size.x == 0 || source.size.y == 0 || area.size.x <= 0 || area.size.y <= 0) {
+        return;
+    } // if there's nothing to tile
+    const Clip clip{
+        ClipTo(size, sf::Vector2u{static_cast<unsigned int>(area.size.x), static_cast<unsigned int>(area.size.y)},
+               area.position)
+    };
+    for(unsigned int row = 0; row < clip.size.y; ++row) {
+        // Tiles line up with area, even where the canvas cuts it off
+        const std::uint8_t* sourceRow{
+            source.pixels + static_cast<std::size_t>((clip.source.y + row) % source.size.y) * source.size.x * 4
+        };
+        std::uint8_t* destination{
+            pixels.data() + ((static_cast<std::size_t>(clip.destination.y) + row) * size.x + clip.destination.x) * 4
+        };
+        unsigned int column{clip.source.x % source.size.x};
+        unsigned int remaining{clip.size.x};
+        while(remaining > 0) {
+            const unsigned int length{std::min(source.size.x - column, remaining)};
+            std::memcpy(destination, sourceRow + static_cast<std::size_t>(column) * 4,
+                        static_cast<std::size_t>(length) * 4);
+            destination += static_cast<std::size_t>(length) * 4;
+            remaining -= length;
+            column = 0;
+        } // while the row isn't full
+    } // for each row
+}
+
+void farcical::Compositor::ScaleAlpha(float opacity) {
+    FARCICAL_PROFILE_SCOPE("Compositor::ScaleAlpha");
+    const auto factor{static_cast<std::uint8_t>(std::lround(std::clamp(opacity, 0.0f, 1.0f) * 255.0f))};
+    ScaleAlphaPixels(pixels.data(), static_cast<std::size_t>(size.x) * size.y, factor);
+}
+
+void farcical::Compositor::BlendOver(const View& source, const sf::Vector2i& position) {
+    FARCICAL_PROFILE_SCOPE("Compositor::BlendOver");
+    const Clip clip{ClipTo(size, source.size, position)};
+    for(unsigned int row = 0; row < clip.size.y; ++row) {
+        BlendPixels(pixels.data() + ((static_cast<std::size_t>(clip.destination.y) + row) * size.x
+                                     + clip.destination.x) * 4,
+                    source.pixels + ((static_cast<std::size_t>(clip.source.y) + row) * source.size.x
+                                     + clip.source.x) * 4,
+                    clip.size.x);
+    } // for each row
+}
+
+void farcical::Compositor::NineSlice(const std::array<View, 4>& corners, const std::array<View, 4>& edges,
+                                     const View& center) {
+    FARCICAL_PROFILE_SCOPE("Compositor::NineSlice");
+    const View& topLeft{corners[static_cast<int>(Rectangle::Corner::TopLeft)]};
+    const View& topRight{corners[static_cast<int>(Rectangle::Corner::TopRight)]};
+    const View& bottomLeft{corners[static_cast<int>(Rectangle::Corner::BottomLeft)]};
+    const View& bottomRight{corners[static_cast<int>(Rectangle::Corner::BottomRight)]};
+    const View& left{edges[static_cast<int>(Rectangle::Edge::Left)]};
+    const View& right{edges[static_cast<int>(Rectangle::Edge::Right)]};
+    const View& top{edges[static_cast<int>(Rectangle::Edge::Top)]};
+    const View& bottom{edges[static_cast<int>(Rectangle::Edge::Bottom)]};
+    const sf::Vector2i canvasSize{static_cast<int>(size.x), static_cast<int>(size.y)};
+
+    // The right-hand column is as wide as the top-right corner, the bottom row as tall as the bottom-left one
+    const int rightColumn{canvasSize.x - static_cast<int>(topRight.size.x)};
+    const int bottomRow{canvasSize.y - static_cast<int>(bottomLeft.size.y)};
+    Blit(topLeft, {0, 0});
+    Blit(topRight, {rightColumn, 0});
+    Blit(bottomLeft, {0, bottomRow});
+    Blit(bottomRight, {rightColumn, bottomRow});
+
+    // Horizontal edges are as tall as the top edge, vertical ones as wide as the left edge
+    const sf::Vector2i horizontalEdgeSize{
+        canvasSize.x - static_cast<int>(topLeft.size.x) - static_cast<int>(topRight.size.x),
+        static_cast<int>(top.size.y)
+    };
+    const sf::Vector2i verticalEdgeSize{
+        static_cast<int>(left.size.x),
+        canvasSize.y - static_cast<int>(topLeft.size.y) - static_cast<int>(bottomLeft.size.y)
+    };
+    Tile(top, sf::IntRect{{static_cast<int>(topLeft.size.x), 0}, horizontalEdgeSize});
+    Tile(bottom, sf::IntRect{{static_cast<int>(bottomLeft.size.x), canvasSize.y - horizontalEdgeSize.y},
+                             horizontalEdgeSize});
+    Tile(left, sf::IntRect{{0, static_cast<int>(topLeft.size.y)}, verticalEdgeSize});
+    Tile(right, sf::IntRect{{rightColumn, static_cast<int>(topRight.size.y)}, verticalEdgeSize});
+
+    const sf::Vector2i centerSize{
+        canvasSize.x - 2 * verticalEdgeSize.x,
+        canvasSize.y - 2 * horizontalEdgeSize.y
+    };
+    Tile(center, sf::IntRect{{verticalEdgeSize.x, static_cast<int>(topLeft.size.y)}, centerSize});
+}
+
+sf::Texture farcical::Compositor::CreateTexture() const {
+    FARCICAL_PROFILE_SCOPE("Compositor::CreateTexture");
+    sf::Texture texture{size, false};
+    texture.update(pixels.data());
+    return texture;
+}
+
+void farcical::Compositor::SetInstructionSet(InstructionSet instructionSet) {
+    ActiveInstructionSet().store(std::min(instructionSet, GetSupportedInstructionSet()), std::memory_order_relaxed);
+}
+
+farcical::Compositor::InstructionSet farcical::Compositor::GetInstructionSet() {
+    return ActiveInstructionSet().load(std::memory_order_relaxed);
+}
+
+farcical::Compositor::InstructionSet farcical::Compositor::GetSupportedInstructionSet() {
+    static const InstructionSet supported{DetectInstructionSet()};
+    return supported;
+}
@@ -327,6 +327,7 @@ std::expected<farcical::BorderTextureProperties, farcical::engine::Error> farcic
     const auto& findCorners{json.find("corners")};
     const auto& findEdges{json.find("edges")};
     const auto& findCenter{json.find("center")};
+    const auto& findNineSlice{json.find("nineSlice")};
     if(findID == json.end()) {
         const std::string failMsg{"Invalid configuration: ResourceID not found."};
         return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
@@ -476,5 +477,9 @@ std::expected<farcical::BorderTextureProperties, farcical::engine::Error> farcic
     properties.percentSize.x = findWidth.value();
     properties.percentSize.y = findHeight.value();
 
+    if(findNineSlice != json.end()) {
+        properties.isNineSlice = findNineSlice.value().get<bool>();
+    } // if nineSlice found
+
     return properties;
 }
@@ -0,0 +1,75 @@
+//
+// Created by dgmuller on 9/11/25.
+//
+
+#include <algorithm>
+#include "../../include/resource/loader.hpp"
+
+unsigned int farcical::ResourceLoader::GetDefaultNumThreads() {
+    const unsigned int numCores{std::thread::hardware_concurrency()};
+    return numCores > 1 ? numCores - 1 : 1;
+}
+
+farcical::ResourceLoader::ResourceLoader(unsigned int numThreads) : numThreads{std::max(numThreads, 1u)},
+                                                                   numActiveJobs{0},
+                                                                   isStopping{false} {
+}
+
+farcical::ResourceLoader::~ResourceLoader() {
+    {
+        std::lock_guard lock{mutex};
+        isStopping = true;
+        jobs.clear();
+    }
+    jobAvailable.notify_all();
+    for(auto& thread: threads) {
+        thread.join();
+    } // for each thread
+}
+
+void farcical::ResourceLoader::Submit(std::function<void()> job) {
+    {
+        std::lock_guard lock{mutex};
+        if(threads.empty()) {
+            threads.reserve(numThreads);
+            for(unsigned int index = 0; index < numThreads; ++index) {
+                threads.emplace_back(&ResourceLoader::Run, this);
+            } // for each thread
+        } // if threads have not been started
+        jobs.push_back(std::move(job));
+    }
+    jobAvailable.notify_one();
+}
+
+void farcical::ResourceLoader::WaitIdle() {
+    std::unique_lock lock{mutex};
+    idle.wait(lock, [this]() {
+        return jobs.empty() && numActiveJobs == 0;
+    });
+}
+
+unsigned int farcical::ResourceLoader::GetNumThreads() const {
+    return numThreads;
+}
+
+void farcical::ResourceLoader::Run() {
+    std::unique_lock lock{mutex};
+    while(true) {
+        jobAvailable.wait(lock, [this]() {
+            return isStopping || !jobs.empty();
+        });
+        if(isStopping) {
+            return;
+        } // if isStopping
+        std::function<void()> job{std::move(jobs.front())};
+        jobs.pop_front();
+        ++numActiveJobs;
+        lock.unlock();
+        job();
+        lock.lock();
+        --numActiveJobs;
+        if(jobs.empty() && numActiveJobs == 0) {
+            idle.notify_all();
+        } // if all jobs are done
+    } // while running
+}
@@ -2,14 +2,22 @@
 // Created by dgmuller on 6/4/25.
 //
 
+#include <algorithm>
+#include <filesystem>
+#include <format>
 #include <fstream>
+#include <iterator>
 #include <SFML/Graphics/Image.hpp>
-#include <SFML/Graphics/RenderTexture.hpp>
-#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/System/Clock.hpp>
 #include "../../include/resource/manager.hpp"
+#include "../../include/engine/hash.hpp"
+#include "../../include/engine/logInterface.hpp"
+#include "../../include/engine/profiler.hpp"
 #include "../../include/geometry.hpp"
 
-farcical::ResourceManager::ResourceManager(): logSystem{nullptr} {
+farcical::ResourceManager::ResourceManager(): looseAssetsOverridePack{false},
+                                             logSystem{nullptr},
+                                             numLoadsInFlight{0} {
 }
 
 void farcical::ResourceManager::AddLogSystem(engine::LogSystem* logSystem) {
@@ -17,15 +25,77 @@ void farcical::ResourceManager::AddLogSystem(engine::LogSystem* logSystem) {
 }
 
 void farcical::ResourceManager::Reset() {
+    // Let outstanding decodes finish so none of them reports back into the cleared maps
+    loader.WaitIdle();
+    {
+        std::lock_guard lock{decodedMutex};
+        decoded.clear();
+    }
+    numLoadsInFlight = 0;
     registry.clear();
-    logs.clear();
     jsonDocs.clear();
     fonts.clear();
     textures.clear();
     musics.clear();
+    fontData.clear();
+    textureSources.clear();
+    sourceFileHashes.clear();
+    // Only once nothing opened from it is left
+    assetPack.Close();
+    if(logSystem && compositeCache.IsEnabled()) {
+        const engine::LogInterface log{*logSystem, "ResourceManager"};
+        const CompositeCache::Statistics& statistics{compositeCache.GetStatistics()};
+        log.LogInfo("CompositeCache: {} hits, {} misses, {} written, {} evicted.", statistics.numHits,
+                    statistics.numMisses, statistics.numWrites, statistics.numEvictions);
+    } // if logSystem & compositeCache are enabled
+    compositeCache = CompositeCache{};
     logSystem = nullptr;
 }
 
+std::optional<farcical::engine::Error> farcical::ResourceManager::MountAssetPack(std::string_view path,
+                                                                                bool looseOverride) {
+    // No worker may be reading the old mapping while it's replaced
+    loader.WaitIdle();
+    const auto& openPack{assetPack.Open(path)};
+    if(openPack.has_value()) {
+        return openPack;
+    } // if openPack == failure
+    looseAssetsOverridePack = looseOverride;
+    // Paths may now resolve to different contents
+    sourceFileHashes.clear();
+    if(logSystem) {
+        const engine::LogInterface log{*logSystem, "ResourceManager"};
+        log.LogInfo("AssetPack {} mounted ({} entries{}).", path, assetPack.GetNumEntries(),
+                    looseOverride ? ", overridden by loose files" : "");
+    } // if logSystem
+    return std::nullopt;
+}
+
+std::optional<std::span<const std::byte>> farcical::ResourceManager::FindPackedAsset(std::string_view path) const {
+    if(!assetPack.IsOpen()) {
+        return std::nullopt;
+    } // if no AssetPack is mounted
+    if(looseAssetsOverridePack) {
+        std::error_code errorCode;
+        if(std::filesystem::exists(path, errorCode)) {
+            return std::nullopt;
+        } // if a loose copy is on disk
+    } // if loose files win
+    return assetPack.Find(path);
+}
+
+void farcical::ResourceManager::SetCompositeCache(std::string_view directory, std::uintmax_t maxSize) {
+    compositeCache = CompositeCache{directory, maxSize};
+    if(logSystem && compositeCache.IsEnabled()) {
+        const engine::LogInterface log{*logSystem, "ResourceManager"};
+        log.LogInfo("CompositeCache enabled in {} (up to {} bytes).", directory, maxSize);
+    } // if logSystem & compositeCache are enabled
+}
+
+const farcical::CompositeCache::Statistics& farcical::ResourceManager::GetCompositeCacheStatistics() const {
+    return compositeCache.GetStatistics();
+}
+
 farcical::ResourceHandle* farcical::ResourceManager::GetResourceHandle(ResourceID id) const {
     const auto resourceIter{registry.find(id)};
     if(resourceIter != registry.end()) {
@@ -49,10 +119,7 @@ std::expected<farcical::ResourceHandle*, farcical::engine::Error> farcical::Reso
 std::optional<farcical::engine::Error> farcical::ResourceManager::DestroyResourceHandle(ResourceID id, ResourceHandle::Type type) {
     switch(type) {
         case ResourceHandle::Type::Log: {
-            const auto& findLog{logs.find(id)};
-            if(findLog != logs.end()) {
-                logs.erase(findLog);
-            }
+            // The log file is owned by LogSystem's writer; nothing is cached here
         }
         break;
         case ResourceHandle::Type::JSONDocument: {
@@ -66,12 +133,14 @@ std::optional<farcical::engine::Error> farcical::ResourceManager::DestroyResourc
             if(findFont != fonts.end()) {
                 fonts.erase(findFont);
             }
+            fontData.erase(id);
         } break;
         case ResourceHandle::Type::Texture: {
             const auto& findTexture{textures.find(id)};
             if(findTexture != textures.end()) {
                 textures.erase(findTexture);
             }
+            textureSources.erase(id);
         } break;
         case ResourceHandle::Type::Sound: {
 
@@ -90,63 +159,21 @@ std::optional<farcical::engine::Error> farcical::ResourceManager::DestroyResourc
     return std::nullopt;
 }
 
-std::expected<farcical::engine::Log*, farcical::engine::Error> farcical::ResourceManager::GetLog(ResourceID id) {
-    ResourceHandle* handle{GetResourceHandle(id)};
-    // If a ResourceHandle with this ResourceID has not been created previously, return Error{ResourceNotFound}
-    if(!handle) {
-        const std::string failMsg{"Resource not found: " + id + "."};
-        return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
-    } // if handle does not exist
-    if(handle->status == ResourceHandle::Status::IsReady) {
-        // Confirm this Log has already been created
-        const auto& logIter{logs.find(id)};
-        if(logIter != logs.end()) {
-            return &logIter->second;
-        } // if Log found
-        // If it wasn't found, mark the ResourceHandle with an Error status & return Error{ResourceNotFound}
-        handle->status = ResourceHandle::Status::Error;
-        const std::string failMsg{"Resource not found: " + id + "."};
-        return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
-    } // if ResourceHandle is marked IsReady
-    if(handle->status == ResourceHandle::Status::Uninitialized) {
-        // Create the Log and load it from file
-        const auto& createLog{logs.emplace(handle->id, engine::Log{{handle->id, handle->path}, {}})};
-        const auto& logIter{createLog.first};
-        std::ifstream inputFromFile{handle->path};
-        if(!std::filesystem::exists(handle->path)) {
-            std::ofstream outputToFile{handle->path, std::ios_base::out};
-            outputToFile.close();
-            inputFromFile.open(handle->path);
-        }
-        while(inputFromFile.good()) {
-            std::string nextLine{""};
-            std::getline(inputFromFile, nextLine);
-            if(!nextLine.empty()) {
-                logIter->second.contents.push_back(nextLine);
-            } // if !nextLine.empty()
-        } // if inputFromFile.good()
-        // If the file was successfully opened, close it
-        if(inputFromFile.is_open()) {
-            inputFromFile.close();
-            handle->status = ResourceHandle::Status::IsReady;
-            return &logIter->second;
-        } // if inputFromFile.is_open()
-        // Otherwise, return Error{InvalidPath}
-        const std::string failMsg{"Invalid path: Could not open Log at " + handle->path + "."};
-        return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
-    } // if ResourceHandle is marked Uninitialized
-    // If we reach this code path, an Error has occurred!
-    const std::string failMsg{"Resource not found: " + id + "."};
-    return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
-}
-
 std::expected<nlohmann::json*, farcical::engine::Error> farcical::ResourceManager::GetJSONDoc(ResourceID id) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::GetJSONDoc");
     ResourceHandle* handle{GetResourceHandle(id)};
     // If a ResourceHandle with this ResourceID has not been created previously, return Error{ResourceNotFound}
     if(!handle) {
         const std::string failMsg{"Resource not found: " + id + "."};
         return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
     } // if handle does not exist
+    if(handle->status == ResourceHandle::Status::Loading) {
+        const auto& waitForLoad{WaitForLoad(id)};
+        if(waitForLoad.has_value()) {
+            return std::unexpected(waitForLoad.value());
+        } // if waitForLoad == failure
+    } // if ResourceHandle is marked Loading
+
     if(handle->status == ResourceHandle::Status::IsReady) {
         // Confirm this JSONDocument has already been created
         const auto& jsonDocIter{jsonDocs.find(id)};
@@ -159,8 +186,15 @@ std::expected<nlohmann::json*, farcical::engine::Error> farcical::ResourceManage
         return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
     } // if ResourceHandle is marked IsReady
     if(handle->status == ResourceHandle::Status::Uninitialized) {
-        // Create the jsonDocument and load it from file
+        // Create the jsonDocument and load it from the AssetPack or from file
         const auto& jsonDocIter{jsonDocs.emplace(id, nlohmann::json{}).first};
+        const auto& findPacked{FindPackedAsset(handle->path)};
+        if(findPacked.has_value()) {
+            const char* text{reinterpret_cast<const char*>(findPacked.value().data())};
+            jsonDocIter->second = nlohmann::json::parse(text, text + findPacked.value().size());
+            handle->status = ResourceHandle::Status::IsReady;
+            return &jsonDocIter->second;
+        } // if jsonDocument is packed
         std::ifstream inputFromFile{handle->path};
         if(inputFromFile.good()) {
             jsonDocIter->second = nlohmann::json::parse(inputFromFile);
@@ -181,6 +215,7 @@ std::expected<nlohmann::json*, farcical::engine::Error> farcical::ResourceManage
 }
 
 std::expected<sf::Font*, farcical::engine::Error> farcical::ResourceManager::GetFont(ResourceID id){
+    FARCICAL_PROFILE_SCOPE("ResourceManager::GetFont");
     ResourceHandle* handle{GetResourceHandle(id)};
     // If a ResourceHandle with this ResourceID has not been created previously, return Error{ResourceNotFound}
     if(!handle) {
@@ -188,6 +223,13 @@ std::expected<sf::Font*, farcical::engine::Error> farcical::ResourceManager::Get
         return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
     } // if handle does not exist
 
+    if(handle->status == ResourceHandle::Status::Loading) {
+        const auto& waitForLoad{WaitForLoad(id)};
+        if(waitForLoad.has_value()) {
+            return std::unexpected(waitForLoad.value());
+        } // if waitForLoad == failure
+    } // if ResourceHandle is marked Loading
+
     if(handle->status == ResourceHandle::Status::IsReady) {
         // Confirm this Font has already been created
         const auto& fontIter{fonts.find(id)};
@@ -203,8 +245,8 @@ std::expected<sf::Font*, farcical::engine::Error> farcical::ResourceManager::Get
     } // if ResourceHandle is marked IsReady
 
     if(handle->status == ResourceHandle::Status::Uninitialized) {
-        // Create the Font and load it from file
-        const auto& fontResult{fonts.emplace(id, sf::Font{handle->path})};
+        // Create the Font and load it from the AssetPack or from file
+        const auto& fontResult{fonts.emplace(id, OpenFont(handle->path))};
         if(!fontResult.second) {
             const std::string failMsg{"Invalid path: Could not open Font at " + handle->path + "."};
             return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
@@ -219,6 +261,7 @@ std::expected<sf::Font*, farcical::engine::Error> farcical::ResourceManager::Get
 }
 
 std::expected<sf::Music*, farcical::engine::Error> farcical::ResourceManager::GetMusic(ResourceID id) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::GetMusic");
     ResourceHandle* handle{GetResourceHandle(id)};
     if(!handle) {
         const std::string failMsg{"Resource not found: " + id + "."};
@@ -236,8 +279,8 @@ std::expected<sf::Music*, farcical::engine::Error> farcical::ResourceManager::Ge
     } // if status == IsReady
 
     if(handle->status == ResourceHandle::Status::Uninitialized) {
-        // Create the Music and load it from file
-        const auto& musicResult{musics.emplace(id, sf::Music{handle->path})};
+        // Create the Music and load it from the AssetPack or from file
+        const auto& musicResult{musics.emplace(id, OpenMusic(handle->path))};
         if(!musicResult.second) {
             const std::string failMsg{"Invalid path: Could not open Music at " + handle->path + "."};
             return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
@@ -259,6 +302,13 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
         return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
     } // if handle does not exist
 
+    if(handle->status == ResourceHandle::Status::Loading) {
+        const auto& waitForLoad{WaitForLoad(id)};
+        if(waitForLoad.has_value()) {
+            return std::unexpected(waitForLoad.value());
+        } // if waitForLoad == failure
+    } // if ResourceHandle is marked Loading
+
     if(handle->status == ResourceHandle::Status::IsReady) {
         // Confirm this Texture has already been created
         const auto& textureIter{textures.find(id)};
@@ -272,12 +322,13 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
     } // if ResourceHandle is marked IsReady
 
     if(handle->status == ResourceHandle::Status::Uninitialized) {
-        // Create the Texture and load it from file
-        const auto& textureResult{textures.emplace(id, sf::Texture{handle->path, false})};
+        // Create the Texture and load it from the AssetPack or from file
+        const auto& textureResult{textures.emplace(id, OpenTexture(handle->path))};
         if(!textureResult.second) {
             const std::string failMsg{"Invalid path: Could not open Texture at " + handle->path + "."};
             return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
         } // if textureResult.second == false
+        textureSources.insert_or_assign(id, TextureSource{handle->path, {}, false, std::nullopt});
         handle->status = ResourceHandle::Status::IsReady;
         return &textureResult.first->second;
     } // if ResourceHandle is marked Uninitialized
@@ -288,6 +339,7 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
 }
 
 std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::GetTexture(TextureProperties properties) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::GetTexture");
     ResourceHandle* handle{GetResourceHandle(properties.id)};
     // If a ResourceHandle with this ResourceID has not been created previously, return Error{ResourceNotFound}
     if(!handle) {
@@ -295,6 +347,13 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
         return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
     } // if handle does not exist
 
+    if(handle->status == ResourceHandle::Status::Loading) {
+        const auto& waitForLoad{WaitForLoad(properties.id)};
+        if(waitForLoad.has_value()) {
+            return std::unexpected(waitForLoad.value());
+        } // if waitForLoad == failure
+    } // if ResourceHandle is marked Loading
+
     if(handle->status == ResourceHandle::Status::IsReady) {
         // Confirm this Texture has already been created
         const auto& textureIter{textures.find(properties.id)};
@@ -309,19 +368,22 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
 
     if(handle->status == ResourceHandle::Status::Uninitialized) {
         if(properties.inputRect.size.x > 0 && properties.inputRect.size.y > 0) {
-            const auto& textureResult{textures.emplace(properties.id, sf::Texture{handle->path, false, properties.inputRect})};
+            const auto& textureResult{textures.emplace(properties.id, OpenTexture(handle->path, properties.inputRect))};
             if(!textureResult.second) {
                 const std::string failMsg{"Invalid path: Could not open Texture at " + handle->path + "."};
                 return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
             } // if textureResult.second == false
+            textureSources.insert_or_assign(properties.id,
+                                            TextureSource{handle->path, properties.inputRect, false, std::nullopt});
             handle->status = ResourceHandle::Status::IsReady;
             return &textureResult.first->second;
         } // if inputRect.size > 0
-        const auto& textureResult{textures.emplace(properties.id, sf::Texture{handle->path, false})};
+        const auto& textureResult{textures.emplace(properties.id, OpenTexture(handle->path))};
         if(!textureResult.second) {
             const std::string failMsg{"Invalid path: Could not open Texture at " + handle->path + "."};
             return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
         } // if textureResult.second == false
+        textureSources.insert_or_assign(properties.id, TextureSource{handle->path, {}, false, std::nullopt});
         handle->status = ResourceHandle::Status::IsReady;
         return &textureResult.first->second;
     } // if ResourceHandle is marked Uninitialized
@@ -405,12 +467,14 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
     if(handle->status == ResourceHandle::Status::Uninitialized) {
         std::vector<ResourceID> segmentList;
         for(const auto& segment: properties.segments) {
-            // Create the Texture and load it from file
-            const auto& segmentResult{textures.emplace(segment.id, sf::Texture{segment.path, false, segment.inputRect})};
+            // Create the Texture and load it from the AssetPack or from file
+            const auto& segmentResult{textures.emplace(segment.id, OpenTexture(segment.path, segment.inputRect))};
             if(!segmentResult.second) {
                 const std::string failMsg{"Invalid path: Could not open Texture at " + segment.path + "."};
                 return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
             } // if segmentResult.second == false
+            textureSources.insert_or_assign(segment.id,
+                                            TextureSource{segment.path, segment.inputRect, false, std::nullopt});
             segmentList.push_back(segment.id);
         } // for each segment in segmentedTexture
         const auto& createSegmentedTexture{CreateSplicedTexture(properties.id, segmentList)};
@@ -425,64 +489,250 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
     return std::unexpected{engine::Error{engine::Error::Signal::ResourceNotFound, failMsg}};
 }
 
-std::optional<farcical::engine::Error> farcical::ResourceManager::WriteLog(
-    ResourceID id, const std::vector<std::string>& messages) {
+std::expected<farcical::ResourceHandle*, farcical::engine::Error> farcical::ResourceManager::RequestTextureAsync(
+    const TextureProperties& properties) {
+    bool isStarted{false};
+    const auto& beginLoad{BeginAsyncLoad(properties.id, ResourceHandle::Type::Texture, properties.path, isStarted)};
+    if(!beginLoad.has_value() || !isStarted) {
+        return beginLoad;
+    } // if beginLoad == failure, or there is nothing to load
+    loader.Submit([this, id = properties.id, path = beginLoad.value()->path, area = properties.inputRect]() {
+        FARCICAL_PROFILE_SCOPE("ResourceManager::DecodeTexture");
+        DecodedResource decodedResource{id, ResourceHandle::Type::Texture, area, sf::Image{}, std::nullopt};
+        sf::Image& image{std::get<sf::Image>(decodedResource.payload)};
+        const auto& findPacked{FindPackedAsset(path)};
+        const bool isLoaded{
+            findPacked.has_value()
+                ? image.loadFromMemory(findPacked.value().data(), findPacked.value().size())
+                : image.loadFromFile(path)
+        };
+        if(!isLoaded) {
+            const std::string failMsg{"Invalid path: Could not open Texture at " + path + "."};
+            decodedResource.failure = engine::Error{engine::Error::Signal::InvalidPath, failMsg};
+        } // if image could not be loaded
+        PushDecoded(std::move(decodedResource));
+    });
+    return beginLoad;
+}
+
+std::expected<farcical::ResourceHandle*, farcical::engine::Error> farcical::ResourceManager::RequestFontAsync(
+    const FontProperties& properties) {
+    bool isStarted{false};
+    const auto& beginLoad{BeginAsyncLoad(properties.id, ResourceHandle::Type::Font, properties.path, isStarted)};
+    if(!beginLoad.has_value() || !isStarted) {
+        return beginLoad;
+    } // if beginLoad == failure, or there is nothing to load
+    loader.Submit([this, id = properties.id, path = beginLoad.value()->path]() {
+        FARCICAL_PROFILE_SCOPE("ResourceManager::DecodeFont");
+        DecodedResource decodedResource{id, ResourceHandle::Type::Font, {}, std::vector<std::byte>{}, std::nullopt};
+        const auto& findPacked{FindPackedAsset(path)};
+        if(findPacked.has_value()) {
+            // Nothing to read: the Font is opened straight from the mapping
+            decodedResource.payload = findPacked.value();
+            PushDecoded(std::move(decodedResource));
+            return;
+        } // if Font is packed
+        std::ifstream inputFromFile{path, std::ios_base::in | std::ios_base::binary};
+        if(!inputFromFile.is_open()) {
+            const std::string failMsg{"Invalid path: Could not open Font at " + path + "."};
+            decodedResource.failure = engine::Error{engine::Error::Signal::InvalidPath, failMsg};
+        } // if file could not be opened
+        else {
+            auto& bytes{std::get<std::vector<std::byte>>(decodedResource.payload)};
+            inputFromFile.seekg(0, std::ios_base::end);
+            bytes.resize(static_cast<std::size_t>(inputFromFile.tellg()));
+            inputFromFile.seekg(0, std::ios_base::beg);
+            inputFromFile.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        } // else read the whole file
+        PushDecoded(std::move(decodedResource));
+    });
+    return beginLoad;
+}
+
+std::expected<farcical::ResourceHandle*, farcical::engine::Error> farcical::ResourceManager::RequestJSONAsync(
+    ResourceID id, std::string_view path) {
+    bool isStarted{false};
+    const auto& beginLoad{BeginAsyncLoad(id, ResourceHandle::Type::JSONDocument, path, isStarted)};
+    if(!beginLoad.has_value() || !isStarted) {
+        return beginLoad;
+    } // if beginLoad == failure, or there is nothing to load
+    loader.Submit([this, id, path = beginLoad.value()->path]() {
+        FARCICAL_PROFILE_SCOPE("ResourceManager::DecodeJSON");
+        DecodedResource decodedResource{id, ResourceHandle::Type::JSONDocument, {}, nlohmann::json{}, std::nullopt};
+        auto& json{std::get<nlohmann::json>(decodedResource.payload)};
+        const auto& findPacked{FindPackedAsset(path)};
+        if(findPacked.has_value()) {
+            const char* text{reinterpret_cast<const char*>(findPacked.value().data())};
+            json = nlohmann::json::parse(text, text + findPacked.value().size(), nullptr, false);
+        } // if JSONDocument is packed
+        else {
+            std::ifstream inputFromFile{path};
+            if(!inputFromFile.is_open()) {
+                const std::string failMsg{"Invalid path: Could not open JSONDocument at " + path + "."};
+                decodedResource.failure = engine::Error{engine::Error::Signal::InvalidPath, failMsg};
+                PushDecoded(std::move(decodedResource));
+                return;
+            } // if file could not be opened
+            json = nlohmann::json::parse(inputFromFile, nullptr, false);
+        } // else parse the file
+        if(json.is_discarded()) {
+            const std::string failMsg{"Invalid configuration: Could not parse JSONDocument at " + path + "."};
+            decodedResource.failure = engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg};
+        } // if parse failed
+        PushDecoded(std::move(decodedResource));
+    });
+    return beginLoad;
+}
+
+std::size_t farcical::ResourceManager::FinishLoads(sf::Time budget) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::FinishLoads");
+    const sf::Clock budgetClock;
+    std::size_t numFinished{0};
+    while(numFinished == 0 || budgetClock.getElapsedTime() < budget) {
+        std::optional<DecodedResource> decodedResource;
+        {
+            std::lock_guard lock{decodedMutex};
+            if(decoded.empty()) {
+                break;
+            } // if nothing is waiting
+            decodedResource.emplace(std::move(decoded.front()));
+            decoded.pop_front();
+        }
+        const auto& finishLoad{FinishLoad(*decodedResource)};
+        if(finishLoad.has_value() && logSystem) {
+            const engine::LogInterface log{*logSystem, "ResourceManager"};
+            log.LogWarning("{}", finishLoad.value().message);
+        } // if finishLoad == failure
+        ++numFinished;
+    } // while within budget
+    return numFinished;
+}
+
+bool farcical::ResourceManager::HasPendingLoads() const {
+    return numLoadsInFlight > 0;
+}
+
+std::expected<farcical::ResourceHandle*, farcical::engine::Error> farcical::ResourceManager::BeginAsyncLoad(
+    ResourceID id, ResourceHandle::Type type, std::string_view path, bool& isStarted) {
+    isStarted = false;
     ResourceHandle* handle{GetResourceHandle(id)};
     if(!handle) {
-        const std::string failMsg{"Resource not found: " + id + "."};
-        return engine::Error{engine::Error::Signal::ResourceNotFound, failMsg};
-    } // if ResourceHandle not found
-    std::ofstream outputFile{handle->path, std::ios_base::app};
-    if(outputFile.good()) {
-        for(const auto& message: messages) {
-            outputFile << message << std::endl;
-        } // for each message
-    } // if outputFile.good()
-    if(outputFile.is_open()) {
-        outputFile.close();
+        const auto& createHandle{CreateResourceHandle(id, type, path)};
+        if(!createHandle.has_value()) {
+            return std::unexpected(createHandle.error());
+        } // if createHandle == failure
+        handle = createHandle.value();
+    } // if handle does not exist
+    if(handle->type != type) {
+        const std::string failMsg{
+            "Invalid configuration: Resource " + id + " is not a " + std::string{ResourceHandle::GetTypeName(type)} + "."
+        };
+        return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
+    } // if handle has the wrong type
+    if(handle->status == ResourceHandle::Status::Uninitialized) {
+        handle->status = ResourceHandle::Status::Loading;
+        ++numLoadsInFlight;
+        isStarted = true;
+    } // if handle has not been loaded
+    return handle;
+}
+
+void farcical::ResourceManager::PushDecoded(DecodedResource decodedResource) {
+    {
+        std::lock_guard lock{decodedMutex};
+        decoded.push_back(std::move(decodedResource));
     }
-    return std::nullopt;
+    decodedCondition.notify_all();
 }
 
-std::optional<farcical::engine::Error> farcical::ResourceManager::AppendToLog(ResourceID id, const std::vector<std::string>& messages) {
+std::optional<farcical::engine::Error> farcical::ResourceManager::FinishLoad(DecodedResource& decodedResource) {
+    --numLoadsInFlight;
+    const ResourceID& id{decodedResource.id};
     ResourceHandle* handle{GetResourceHandle(id)};
-    if(!handle) {
-        const std::string failMsg{"Resource not found: " + id + "."};
-        return engine::Error{engine::Error::Signal::ResourceNotFound, failMsg};
-    } // if ResourceHandle not found
-    std::ofstream outputFile{handle->path, std::ios_base::out | std::ios_base::app};
-    if(outputFile.good()) {
-        for(const auto& message: messages) {
-            outputFile << message << std::endl;
-        } // for each message
-    } // if outputFile.good()
-    if(outputFile.is_open()) {
-        outputFile.close();
-    }
+    if(!handle || handle->status != ResourceHandle::Status::Loading) {
+        // Destroyed while it was loading; drop the result
+        return std::nullopt;
+    } // if handle no longer wants this result
+    if(decodedResource.failure.has_value()) {
+        handle->status = ResourceHandle::Status::Error;
+        return decodedResource.failure;
+    } // if decoding failed
+
+    switch(decodedResource.type) {
+        case ResourceHandle::Type::Texture: {
+            FARCICAL_PROFILE_SCOPE("ResourceManager::UploadTexture");
+            const sf::Image& image{std::get<sf::Image>(decodedResource.payload)};
+            sf::Texture texture;
+            if(!texture.loadFromImage(image, false, decodedResource.area)) {
+                handle->status = ResourceHandle::Status::Error;
+                const std::string failMsg{"Error: Failed to create Texture " + id + " from " + handle->path + "."};
+                return engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg};
+            } // if texture could not be created
+            textures.insert_or_assign(id, std::move(texture));
+            textureSources.insert_or_assign(id, TextureSource{handle->path, decodedResource.area, false, std::nullopt});
+        }
+        break;
+        case ResourceHandle::Type::Font: {
+            // A packed Font reads from the AssetPack's mapping; a loose one from fontData
+            std::span<const std::byte> bytes;
+            if(const auto* packedBytes{std::get_if<std::span<const std::byte>>(&decodedResource.payload)}) {
+                bytes = *packedBytes;
+            } // if Font is packed
+            else {
+                bytes = fontData.insert_or_assign(id, std::move(std::get<std::vector<std::byte>>(decodedResource.payload)))
+                                .first->second;
+            } // else keep the bytes that were read
+            sf::Font& font{fonts.insert_or_assign(id, sf::Font{}).first->second};
+            if(!font.openFromMemory(bytes.data(), bytes.size())) {
+                fonts.erase(id);
+                fontData.erase(id);
+                handle->status = ResourceHandle::Status::Error;
+                const std::string failMsg{"Error: Failed to open Font " + id + " from " + handle->path + "."};
+                return engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg};
+            } // if font could not be opened
+        }
+        break;
+        case ResourceHandle::Type::JSONDocument: {
+            jsonDocs.insert_or_assign(id, std::move(std::get<nlohmann::json>(decodedResource.payload)));
+        }
+        break;
+        default: {
+            handle->status = ResourceHandle::Status::Error;
+            const std::string failMsg{"Invalid configuration: Resource " + id + " cannot be loaded asynchronously."};
+            return engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg};
+        }
+    } // switch type
+    handle->status = ResourceHandle::Status::IsReady;
     return std::nullopt;
 }
 
-std::optional<farcical::engine::Error> farcical::ResourceManager::AppendToLog(
-    engine::Log* log, const std::vector<std::string>& messages) {
-    if(!log) {
-        const std::string failMsg{"Unexpected nullptr: log"};
-        return engine::Error{engine::Error::Signal::NullPtr, failMsg};
-    } // if !log
-    std::ofstream outputFile{log->resource.second, std::ios_base::out | std::ios_base::app};
-    if(outputFile.good()) {
-        for(const auto& message: messages) {
-            outputFile << message << std::endl;
-        } // for each message
-    } // if outputFile.good()
-    if(outputFile.is_open()) {
-        outputFile.close();
+std::optional<farcical::engine::Error> farcical::ResourceManager::WaitForLoad(ResourceID id) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::WaitForLoad");
+    std::optional<DecodedResource> decodedResource;
+    {
+        std::unique_lock lock{decodedMutex};
+        decodedCondition.wait(lock, [this, &id, &decodedResource]() {
+            const auto& findDecoded{
+                std::find_if(decoded.begin(), decoded.end(), [&id](const DecodedResource& candidate) {
+                    return candidate.id == id;
+                })
+            };
+            if(findDecoded == decoded.end()) {
+                return false;
+            } // if not decoded yet
+            decodedResource.emplace(std::move(*findDecoded));
+            decoded.erase(findDecoded);
+            return true;
+        });
     }
-    return std::nullopt;
+    return FinishLoad(*decodedResource);
 }
 
 std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::CreateSplicedTexture(
     ResourceID id, const std::vector<ResourceID>& inputTextureIDs) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::CreateSplicedTexture");
     sf::Vector2u totalSize{0, 0};
+    std::vector<sf::Texture*> inputTextures;
     // Compute the total size of all textures spliced together (horizontally)
     for(const auto& textureID : inputTextureIDs) {
         const auto& requestTexture{GetTexture(textureID)};
@@ -491,6 +741,7 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
             return std::unexpected(requestTexture.error());
         }
         sf::Texture& texture{*requestTexture.value()};
+        inputTextures.push_back(&texture);
         // Add requested Texture's width to the totalSize
         totalSize.x += texture.getSize().x;
         // If totalSize is shorter than requested Texture, set its height to requested Texture's
@@ -499,32 +750,32 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
         }
     }
 
-    // Create a new texture of the appropriate size
-    const auto& createTexture{textures.emplace(id, sf::Texture{totalSize})};
+    const std::optional<std::uint64_t> compositeKey{GetCompositeKey("spliced", inputTextureIDs)};
+    sf::Texture* cachedTexture{ReadComposite(id, compositeKey)};
+    if(cachedTexture) {
+        return cachedTexture;
+    } // if splicedTexture was cached
+
+    // Copy each inputTexture side by side into one canvas, then upload it once
+    Compositor compositor{totalSize};
+    int destX{0};
+    for(const sf::Texture* texture : inputTextures) {
+        const sf::Image inputImage{texture->copyToImage()};
+        compositor.Blit(Compositor::ViewOf(inputImage), sf::Vector2i{destX, 0});
+        destX += static_cast<int>(texture->getSize().x);
+    }
+    const auto& createTexture{textures.emplace(id, compositor.CreateTexture())};
     if(!createTexture.second) {
         const std::string failMsg{"Invalid configuration: Failed to create splicedTexture with id=" + id + "."};
         return std::unexpected{engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg}};
     }
-    sf::Texture& splicedTexture{createTexture.first->second};
-    sf::Vector2u dest{0, 0};
-    // Copy each inputTexture into the splicedTexture
-    for(const auto& textureID : inputTextureIDs) {
-        auto requestTexture{GetTexture(textureID)};
-        // If requested Texture not found, return Error
-        if(!requestTexture.has_value()) {
-            return std::unexpected(requestTexture.error());
-        }
-        sf::Texture& texture{*requestTexture.value()};
-        // Copy inputTexture into splicedTexture at dest
-        splicedTexture.update(texture, dest);
-        dest.x += texture.getSize().x;
-    }
-
-    return &splicedTexture;
+    WriteComposite(id, compositeKey, compositor);
+    return &createTexture.first->second;
 }
 
 std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::CreateRepeatingTexture(
     ResourceID id, const sf::Vector2u& outputSize, ResourceID inputID, sf::IntRect inputRect) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::CreateRepeatingTexture");
     ResourceHandle* inputHandle{GetResourceHandle(inputID)};
     // If a ResourceHandle with inputID has not been created previously, return Error{ResourceNotFound}
     if(!inputHandle) {
@@ -532,98 +783,60 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
         return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
     } // if handle does not exist
 
-    // Create a blank canvas, which we will fill with repeating tiles.
-    const auto& createTextureResult{
-        textures.emplace(id, sf::Texture{outputSize, false})
+    const std::optional<std::uint64_t> compositeKey{
+        GetCompositeKey(std::format("repeating:{}x{}@{},{}+{}x{}", outputSize.x, outputSize.y, inputRect.position.x,
+                                    inputRect.position.y, inputRect.size.x, inputRect.size.y), {inputID})
     };
-    if(createTextureResult.second) {
-        sf::Texture* outputTexture{nullptr};
-        // Retrieve the blank Texture we just created
-        const auto& findOutputTexture{textures.find(id)};
-        if(findOutputTexture != textures.end()) {
-            outputTexture = &findOutputTexture->second;
+    sf::Texture* cachedTexture{ReadComposite(id, compositeKey)};
+    if(cachedTexture) {
+        return cachedTexture;
+    } // if outputTexture was cached
+
+    // Retrieve the inputTexture
+    sf::Texture* inputTexture{nullptr};
+    if(inputRect.size.x > 0 && inputRect.size.y > 0) {
+        TextureProperties properties;
+        properties.id = inputID;
+        properties.path = inputHandle->path;
+        properties.scale = 1.0f;
+        properties.inputRect = inputRect;
+        const auto& requestInputTexture{GetTexture(properties)};
+        if(requestInputTexture.has_value()) {
+            inputTexture = requestInputTexture.value();
         }
         else {
-            const std::string failMsg{"Resource not found: " + id + "."};
+            const std::string failMsg{"Resource not found: " + inputID + "."};
             return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
         }
-
-        // Retrieve the inputTexture
-        sf::Texture* inputTexture{nullptr};
-        if(inputRect.size.x > 0 && inputRect.size.y > 0) {
-            TextureProperties properties;
-            properties.id = inputID;
-            properties.path = inputHandle->path;
-            properties.scale = 1.0f;
-            properties.inputRect = inputRect;
-            const auto& requestInputTexture{GetTexture(properties)};
-            if(requestInputTexture.has_value()) {
-                inputTexture = requestInputTexture.value();
-            }
-            else {
-                const std::string failMsg{"Resource not found: " + inputID + "."};
-                return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
-            }
-        }  // if inputRect.size > 0
+    }  // if inputRect.size > 0
+    else {
+        const auto& requestInputTexture{GetTexture(inputID)};
+        if(requestInputTexture.has_value()) {
+            inputTexture = requestInputTexture.value();
+        }
         else {
-            const auto& requestInputTexture{GetTexture(inputID)};
-            if(requestInputTexture.has_value()) {
-                inputTexture = requestInputTexture.value();
-            }
-            else {
-                const std::string failMsg{"Resource not found: " + inputID + "."};
-                return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
-            }
-        } // else inputRect.size <= 0
-
-        // Fill outputTexture with inputTextures
-        RepeatTexture(*inputTexture, *outputTexture);
-
-        const unsigned int widthInTiles{outputTexture->getSize().x / inputTexture->getSize().x};
-        const unsigned int heightInTiles{outputTexture->getSize().y / inputTexture->getSize().y};
-
-        // If we have a fractional tile on the x-axis...
-        if(inputTexture->getSize().x * widthInTiles < outputTexture->getSize().x) {
-            RepeatSliceHorizontal(*inputTexture, *outputTexture);
-        } // if fractional tile on x-axis
-
-        // If we have a fractional tile on the y-axis...
-        if(inputTexture->getSize().y * heightInTiles < outputTexture->getSize().y) {
-            RepeatSliceVertical(*inputTexture, *outputTexture);
-        } // if fractional tile on y-axis
-
-        // If we have a fractional tile on both the x-axis AND the y-axis...
-        if(inputTexture->getSize().x * widthInTiles < outputTexture->getSize().x
-        && inputTexture->getSize().y * heightInTiles < outputTexture->getSize().y) {
-            const sf::Vector2u sliceSize{
-                outputTexture->getSize().x - (inputTexture->getSize().x * widthInTiles),
-                outputTexture->getSize().y - (inputTexture->getSize().y * heightInTiles)
-            };
-            sf::Image slice{sliceSize};
-            const sf::IntRect sourceRect{
-                    {0, 0},
-                    {static_cast<int>(sliceSize.x), static_cast<int>(sliceSize.y)},
-                };
-            sf::Image inputImage{inputTexture->copyToImage()};
-            bool copySuccess{slice.copy(inputImage, sf::Vector2u{0, 0}, sourceRect)};
-            if(copySuccess) {
-                // Copy that slice over at the end of the last column/row
-                const sf::Texture sliceTexture{slice};
-                const sf::Vector2u dest{
-                    inputTexture->getSize().x * widthInTiles,
-                    inputTexture->getSize().y * heightInTiles,
-                };
-                outputTexture->update(sliceTexture, dest);
-            } // if copySuccess
-        } // If we have a fractional tile on both the x-axis AND the y-axis
-        return outputTexture;
-    } // if createTextureResult.second
-    const std::string failMsg{"Invalid configuration: Failed to create Texture " + id + "."};
-    return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
+            const std::string failMsg{"Resource not found: " + inputID + "."};
+            return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
+        }
+    } // else inputRect.size <= 0
+
+    // Fill a canvas with inputTexture tiles, cutting the last column & row short, then upload it once
+    const sf::Image inputImage{inputTexture->copyToImage()};
+    Compositor compositor{outputSize};
+    compositor.Tile(Compositor::ViewOf(inputImage),
+                    sf::IntRect{{0, 0}, {static_cast<int>(outputSize.x), static_cast<int>(outputSize.y)}});
+    const auto& createTextureResult{textures.emplace(id, compositor.CreateTexture())};
+    if(!createTextureResult.second) {
+        const std::string failMsg{"Invalid configuration: Failed to create Texture " + id + "."};
+        return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
+    } // if createTextureResult == failure
+    WriteComposite(id, compositeKey, compositor);
+    return &createTextureResult.first->second;
 }
 
 std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::CreateOverlayTexture(
     ResourceID id, ResourceID baseTextureID, ResourceID overlayTextureID, float opacity) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::CreateOverlayTexture");
     const ResourceID baseID{baseTextureID + "Texture"};
     const ResourceID overlayID{overlayTextureID + "Texture"};
     const ResourceID outputID{id + "Texture"};
@@ -663,40 +876,46 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
         return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
     } // if getOverlayTexture == failure
     sf::Texture* overlayTexture{getOverlayTexture.value()};
-    sf::Texture overlayCopy{*overlayTexture};
-
-    // Create a semi-transparent copy of the overlayTexture (with the given opacity)
-    sf::Image overlayImage{overlayCopy.copyToImage()};
-
-    const auto& overlaySize{overlayImage.getSize()};
-    for(unsigned int y = 0; y < overlaySize.y; ++y) {
-        for(unsigned int x = 0; x < overlaySize.x; ++x) {
-            sf::Color overlayPixelColor{overlayImage.getPixel(sf::Vector2u{x, y})};
-            // next line is equivalent to pixelColor.a *= opacity
-            overlayPixelColor.a = static_cast<uint8_t>(static_cast<float>(overlayPixelColor.a) * opacity);
-            overlayImage.setPixel(sf::Vector2u{x, y}, overlayPixelColor);
-        } // for x
-    } // for y
-    overlayCopy.update(overlayImage);
-
-    sf::Sprite baseSprite{*baseTexture};
-    sf::Sprite overlaySprite{overlayCopy};
-    sf::RenderTexture outputTexture{baseTexture->getSize()};
-    outputTexture.draw(baseSprite);
-    outputTexture.draw(overlaySprite);
+
+    const std::optional<std::uint64_t> compositeKey{
+        GetCompositeKey(std::format("overlay:{}", opacity), {baseID, overlayID})
+    };
+    sf::Texture* cachedTexture{ReadComposite(outputID, compositeKey)};
+    if(cachedTexture) {
+        const auto& createHandle{CreateResourceHandle(outputID, ResourceHandle::Type::Texture, "")};
+        if(!createHandle.has_value()) {
+            const std::string failMsg{
+                "Failed to create ResourceHandle for overlayTexture with ID=\"" + outputID + "\"."
+            };
+            return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
+        } // if createHandle == failure
+        createHandle.value()->status = ResourceHandle::Status::IsReady;
+        return cachedTexture;
+    } // if outputTexture was cached
+
+    // Fade a copy of overlayTexture to opacity, then blend it over baseTexture the way a RenderTexture would
+    const sf::Image baseImage{baseTexture->copyToImage()};
+    const sf::Image overlayImage{overlayTexture->copyToImage()};
+    Compositor fadedOverlay{overlayImage.getSize()};
+    fadedOverlay.Blit(Compositor::ViewOf(overlayImage), sf::Vector2i{0, 0});
+    fadedOverlay.ScaleAlpha(opacity);
+    Compositor compositor{baseImage.getSize()};
+    compositor.BlendOver(Compositor::ViewOf(baseImage), sf::Vector2i{0, 0});
+    compositor.BlendOver(fadedOverlay.GetView(), sf::Vector2i{0, 0});
 
     const auto& createHandle{CreateResourceHandle(outputID, ResourceHandle::Type::Texture, "")};
     if(!createHandle.has_value()) {
         const std::string failMsg{"Failed to create ResourceHandle for overlayTexture with ID=\"" + outputID + "\"."};
         return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
     } // if createHandle == failure
-    const auto& insertTexture{textures.emplace(outputID, outputTexture.getTexture())};
+    const auto& insertTexture{textures.emplace(outputID, compositor.CreateTexture())};
     if(!insertTexture.second) {
         const std::string failMsg{"ResourceManager failed to insert overlayTexture with ID=\"" + outputID + "\"."};
         return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
     } // if insertTexture == failure
     ResourceHandle* handle{createHandle.value()};
     handle->status = ResourceHandle::Status::IsReady;
+    WriteComposite(outputID, compositeKey, compositor);
     return &insertTexture.first->second;
 }
 
@@ -706,6 +925,7 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
     const std::vector<ResourceID>& cornerTextureIDs,
     const std::vector<ResourceID>& edgeTextureIDs,
     ResourceID centerTextureID) {
+    FARCICAL_PROFILE_SCOPE("ResourceManager::CreateBorderTexture");
     ResourceHandle* borderHandle{GetResourceHandle(id)};
     // If a ResourceHandle with this ID has not been created previously, create it
     if(!borderHandle) {
@@ -768,209 +988,175 @@ std::expected<sf::Texture*, farcical::engine::Error> farcical::ResourceManager::
     } // if requestTexture failed
     sf::Texture* centerTexture{requestTexture.value()};
 
-    // Create a blank canvas for our Border
-    const auto& createTextureResult{
-        textures.emplace(id, sf::Texture{outputSize, false})
+    std::vector<ResourceID> inputIDs{cornerTextureIDs};
+    inputIDs.insert(inputIDs.end(), edgeTextureIDs.begin(), edgeTextureIDs.end());
+    inputIDs.push_back(centerTextureID);
+    const std::optional<std::uint64_t> compositeKey{
+        GetCompositeKey(std::format("border:{}x{}", outputSize.x, outputSize.y), inputIDs)
     };
-    if(createTextureResult.second) {
-        sf::Texture* outputTexture{nullptr};
-        // Retrieve the blank Texture we just created
-        const auto& findOutputTexture{textures.find(id)};
-        if(findOutputTexture == textures.end()) {
-            const std::string failMsg{"Resource not found: " + id + "."};
-            return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
-        } // if outputTexture not found
-        outputTexture = &findOutputTexture->second;
-
-        // Copy corners into the outputTexture
-        const sf::Vector2u topLeftPosition{0, 0};
-        outputTexture->update(*cornerTextures[static_cast<int>(Rectangle::Corner::TopLeft)], topLeftPosition);
-        const sf::Vector2u topRightPosition{
-            outputSize.x - cornerTextures[static_cast<int>(Rectangle::Corner::TopRight)]->getSize().x, 0
-        };
-        outputTexture->update(*cornerTextures[static_cast<int>(Rectangle::Corner::TopRight)], topRightPosition);
-        const sf::Vector2u bottomLeftPosition{
-            0, outputSize.y - cornerTextures[static_cast<int>(Rectangle::Corner::BottomLeft)]->getSize().y
-        };
-        outputTexture->update(*cornerTextures[static_cast<int>(Rectangle::Corner::BottomLeft)], bottomLeftPosition);
-        const sf::Vector2u bottomRightPosition{
-            outputSize.x - cornerTextures[static_cast<int>(Rectangle::Corner::TopRight)]->getSize().x,
-            outputSize.y - cornerTextures[static_cast<int>(Rectangle::Corner::BottomLeft)]->getSize().y
-        };
-        outputTexture->update(*cornerTextures[static_cast<int>(Rectangle::Corner::BottomRight)], bottomRightPosition);
-
-        // Create edges of the appropriate size by repeating our input edge Textures
-        // Vertical edges - Left and Right
-        const sf::Vector2u vEdgeSize{
-            edgeTextures[static_cast<int>(Rectangle::Edge::Left)]->getSize().x,
-            outputSize.y
-            - cornerTextures[static_cast<int>(Rectangle::Corner::TopLeft)]->getSize().y
-            - cornerTextures[static_cast<int>(Rectangle::Corner::BottomLeft)]->getSize().y
-        };
-        // Horizontal edges - Top and Bottom
-        const sf::Vector2u hEdgeSize{
-            outputSize.x
-            - cornerTextures[static_cast<int>(Rectangle::Corner::TopLeft)]->getSize().x
-            - cornerTextures[static_cast<int>(Rectangle::Corner::TopRight)]->getSize().x,
-            edgeTextures[static_cast<int>(Rectangle::Edge::Top)]->getSize().y
-        };
-        sf::Texture topTexture{hEdgeSize, false};
-        sf::Texture bottomTexture{hEdgeSize, false};
-        sf::Texture leftTexture{vEdgeSize, false};
-        sf::Texture rightTexture{vEdgeSize, false};
-
-        // Create the edges
-        RepeatTexture(*edgeTextures[static_cast<int>(Rectangle::Edge::Top)], topTexture);
-        RepeatTexture(*edgeTextures[static_cast<int>(Rectangle::Edge::Bottom)], bottomTexture);
-        RepeatTexture(*edgeTextures[static_cast<int>(Rectangle::Edge::Left)], leftTexture);
-        RepeatTexture(*edgeTextures[static_cast<int>(Rectangle::Edge::Right)], rightTexture);
-
-        // Check to see whether the tiles filled the Texture evenly, or if there are "slices" missing
-        // If so, fill in those slices
-        unsigned int widthInTiles{hEdgeSize.x / edgeTextures[static_cast<int>(Rectangle::Edge::Top)]->getSize().x};
-        unsigned int heightInTiles{vEdgeSize.y / edgeTextures[static_cast<int>(Rectangle::Edge::Left)]->getSize().y};
-        if(edgeTextures[static_cast<int>(Rectangle::Edge::Top)]->getSize().x * widthInTiles < hEdgeSize.x) {
-            RepeatSliceHorizontal(*edgeTextures[static_cast<int>(Rectangle::Edge::Top)], topTexture);
-        } // if edge tile width * widthInTiles < edge width
-        if(edgeTextures[static_cast<int>(Rectangle::Edge::Bottom)]->getSize().x * widthInTiles < hEdgeSize.x) {
-            RepeatSliceHorizontal(*edgeTextures[static_cast<int>(Rectangle::Edge::Bottom)], bottomTexture);
-        } // if edge tile with * widthInTiles < edge width
-        if(edgeTextures[static_cast<int>(Rectangle::Edge::Left)]->getSize().y * heightInTiles < vEdgeSize.y) {
-            RepeatSliceVertical(*edgeTextures[static_cast<int>(Rectangle::Edge::Left)], leftTexture);
-        } // if edge tile height * heightInTiles < edge height
-        if(edgeTextures[static_cast<int>(Rectangle::Edge::Top)]->getSize().y * heightInTiles < vEdgeSize.y) {
-            RepeatSliceVertical(*edgeTextures[static_cast<int>(Rectangle::Edge::Right)], rightTexture);
-        } // if edge tile height * heightInTiles < edge height
-
-        // Copy them into the outputTexture
-        const sf::Vector2u topPosition{
-            topLeftPosition.x + cornerTextures[static_cast<int>(Rectangle::Corner::TopLeft)]->getSize().x,
-            0
-        };
-        outputTexture->update(topTexture, topPosition);
-        const sf::Vector2u bottomPosition{
-            bottomLeftPosition.x + cornerTextures[static_cast<int>(Rectangle::Corner::BottomLeft)]->getSize().x,
-            outputSize.y - bottomTexture.getSize().y
-        };
-        outputTexture->update(bottomTexture, bottomPosition);
-        const sf::Vector2u leftPosition{
-            0,
-            topLeftPosition.y + cornerTextures[static_cast<int>(Rectangle::Corner::TopLeft)]->getSize().y
-        };
-        outputTexture->update(leftTexture, leftPosition);
-        const sf::Vector2u rightPosition{
-            topRightPosition.x,
-            topRightPosition.y + cornerTextures[static_cast<int>(Rectangle::Corner::TopRight)]->getSize().y
-        };
-        outputTexture->update(rightTexture, rightPosition);
+    sf::Texture* cachedTexture{ReadComposite(id, compositeKey)};
+    if(cachedTexture) {
+        return cachedTexture;
+    } // if Border was cached
+
+    // Lay the whole Border out in one canvas, then upload it once
+    std::array<sf::Image, static_cast<int>(Rectangle::Corner::NumCorners)> cornerImages;
+    std::array<Compositor::View, static_cast<int>(Rectangle::Corner::NumCorners)> cornerViews;
+    for(int index = static_cast<int>(Rectangle::Corner::TopLeft);
+        index < static_cast<int>(Rectangle::Corner::NumCorners); ++index) {
+        cornerImages[index] = cornerTextures[index]->copyToImage();
+        cornerViews[index] = Compositor::ViewOf(cornerImages[index]);
+    } // for each Corner
+    std::array<sf::Image, static_cast<int>(Rectangle::Edge::NumEdges)> edgeImages;
+    std::array<Compositor::View, static_cast<int>(Rectangle::Edge::NumEdges)> edgeViews;
+    for(int index = static_cast<int>(Rectangle::Edge::Left); index < static_cast<int>(Rectangle::Edge::NumEdges); ++
+        index) {
+        edgeImages[index] = edgeTextures[index]->copyToImage();
+        edgeViews[index] = Compositor::ViewOf(edgeImages[index]);
+    } // for each Edge
+    const sf::Image centerImage{centerTexture->copyToImage()};
+    Compositor compositor{outputSize};
+    compositor.NineSlice(cornerViews, edgeViews, Compositor::ViewOf(centerImage));
 
-        // Create the center
-        sf::Vector2u centerSize{
-            outputSize.x - leftTexture.getSize().x - rightTexture.getSize().x,
-            outputSize.y - topTexture.getSize().y - bottomTexture.getSize().y
-        };
-        sf::Texture bigCenterTexture{centerSize, false};
-        RepeatTexture(*centerTexture, bigCenterTexture);
-
-        // Check to see whether the tiles filled the Texture evenly, or if there are "slices" missing
-        // If so, fill those slices in
-        unsigned int centerWidthInTiles{centerSize.x / centerTexture->getSize().x};
-        unsigned int centerHeightInTiles{centerSize.y / centerTexture->getSize().y};
-        if(centerTexture->getSize().x * centerWidthInTiles < centerSize.x) {
-            RepeatSliceHorizontal(*centerTexture, bigCenterTexture);
-        } // if center tile width * widthInTiles < center width
-        if(centerTexture->getSize().y * centerHeightInTiles < centerSize.y) {
-            RepeatSliceVertical(*centerTexture, bigCenterTexture);
-        } // if center tile height * heightInTiles < center height
-
-        // Copy it into the outputTexture
-        sf::Vector2u centerPosition{
-            leftPosition.x + leftTexture.getSize().x,
-            leftPosition.y
-        };
-        outputTexture->update(bigCenterTexture, centerPosition);
-        return outputTexture;
-    } // if createTextureResult == success
-
-    const std::string failMsg{"Invalid configuration: Failed to create Texture " + id + "."};
-    return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
-}
-
-void farcical::ResourceManager::RepeatTexture(sf::Texture& input, sf::Texture& output) {
-    // Calculate # of tiles that fit in outputTexture, then copy inputTexture into outputTexture that many times
-    const unsigned int widthInTiles{output.getSize().x / input.getSize().x};
-    const unsigned int heightInTiles{output.getSize().y / input.getSize().y};
-    for(unsigned int y = 0; y < heightInTiles; y++) {
-        for(unsigned int x = 0; x < widthInTiles; x++) {
-            output.update(input, sf::Vector2u{x * input.getSize().x,y * input.getSize().y});
-        } // for x
-    } // for y
-}
-
-void farcical::ResourceManager::RepeatSliceHorizontal(sf::Texture& input, sf::Texture& output) {
-    // How many whole inputs have been tiled into output?
-    const unsigned int widthInTiles{output.getSize().x / input.getSize().x};
-    const unsigned int heightInTiles{output.getSize().y / input.getSize().y};
-
-    // Calculate the remainder on the x-axis
-    const sf::Vector2u sliceSize{
-        output.getSize().x - (input.getSize().x * widthInTiles),
-        input.getSize().y
-    };
+    const auto& createTextureResult{textures.emplace(id, compositor.CreateTexture())};
+    if(!createTextureResult.second) {
+        const std::string failMsg{"Invalid configuration: Failed to create Texture " + id + "."};
+        return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
+    } // if createTextureResult == failure
+    WriteComposite(id, compositeKey, compositor);
+    return &createTextureResult.first->second;
+}
 
-    // Create inputImage from inputTexture
-    sf::Image inputImage{input.copyToImage()};
+sf::Texture farcical::ResourceManager::OpenTexture(const std::string& path, const sf::IntRect& area) const {
+    const auto& findPacked{FindPackedAsset(path)};
+    if(findPacked.has_value()) {
+        return sf::Texture{findPacked.value().data(), findPacked.value().size(), false, area};
+    } // if Texture is packed
+    return sf::Texture{path, false, area};
+}
 
-    // Grab a "slice" of the inputImage of the appropriate size
-    sf::Image slice{sliceSize};
-    const sf::IntRect sourceRect{
-        {0, 0},
-        {static_cast<int>(sliceSize.x), static_cast<int>(sliceSize.y)},
-    };
-    bool copySuccess{slice.copy(inputImage, sf::Vector2u{0, 0}, sourceRect)};
-    if(copySuccess) {
-        // Copy that slice at the end of each row
-        const sf::Texture sliceTexture{slice};
-        for(unsigned int y = 0; y < heightInTiles; ++y) {
-            const sf::Vector2u dest{
-                input.getSize().x * widthInTiles,
-                y * input.getSize().y
-            };
-            output.update(sliceTexture, dest);
-        } // for each row
-    } // if copySuccess
+sf::Font farcical::ResourceManager::OpenFont(const std::string& path) const {
+    const auto& findPacked{FindPackedAsset(path)};
+    if(findPacked.has_value()) {
+        return sf::Font{findPacked.value().data(), findPacked.value().size()};
+    } // if Font is packed
+    return sf::Font{path};
 }
 
-void farcical::ResourceManager::RepeatSliceVertical(sf::Texture& input, sf::Texture& output) {
-    // How many whole inputs have been tiled into output?
-    const unsigned int widthInTiles{output.getSize().x / input.getSize().x};
-    const unsigned int heightInTiles{output.getSize().y / input.getSize().y};
+sf::Music farcical::ResourceManager::OpenMusic(const std::string& path) const {
+    const auto& findPacked{FindPackedAsset(path)};
+    if(findPacked.has_value()) {
+        return sf::Music{findPacked.value().data(), findPacked.value().size()};
+    } // if Music is packed
+    return sf::Music{path};
+}
 
-    // Calculate the remainder on the y-axis
-    const sf::Vector2u sliceSize{
-        input.getSize().x,
-        output.getSize().y - (input.getSize().x * heightInTiles)
+std::optional<std::uint64_t> farcical::ResourceManager::HashSourceFile(const std::string& path) {
+    const auto& findPacked{FindPackedAsset(path)};
+    std::error_code sizeErrorCode;
+    std::error_code timeErrorCode;
+    const std::uintmax_t size{
+        findPacked.has_value() ? findPacked.value().size() : std::filesystem::file_size(path, sizeErrorCode)
+    };
+    const std::filesystem::file_time_type modifiedTime{
+        findPacked.has_value()
+            ? std::filesystem::file_time_type{}
+            : std::filesystem::last_write_time(path, timeErrorCode)
     };
+    if(sizeErrorCode || timeErrorCode) {
+        return std::nullopt;
+    } // if file could not be examined
+    const auto& findHash{sourceFileHashes.find(path)};
+    if(findHash != sourceFileHashes.end()
+       && findHash->second.size == size && findHash->second.modifiedTime == modifiedTime) {
+        return findHash->second.hash;
+    } // if file hasn't changed since it was hashed
+
+    std::uint64_t hash{0};
+    if(findPacked.has_value()) {
+        hash = engine::HashBytes(std::string_view{
+            reinterpret_cast<const char*>(findPacked.value().data()), findPacked.value().size()
+        });
+    } // if file is packed
+    else {
+        std::ifstream input{path, std::ios_base::in | std::ios_base::binary};
+        if(!input.is_open()) {
+            return std::nullopt;
+        } // if file could not be opened
+        const std::string bytes{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+        hash = engine::HashBytes(bytes);
+    } // else read it from disk
+    sourceFileHashes.insert_or_assign(path, SourceFileHash{size, modifiedTime, hash});
+    return hash;
+}
+
+std::optional<std::uint64_t> farcical::ResourceManager::GetTextureSourceKey(ResourceID id) {
+    const auto& findSource{textureSources.find(id)};
+    if(findSource == textureSources.end()) {
+        return std::nullopt;
+    } // if it's unknown where id came from
+    const TextureSource& source{findSource->second};
+    if(source.isComposite) {
+        return source.compositeKey;
+    } // if id is a composite
+    const auto& hashFile{HashSourceFile(source.path)};
+    if(!hashFile.has_value()) {
+        return std::nullopt;
+    } // if hashFile == failure
+    return engine::HashBytes(std::format("file:{:016x}@{},{}+{}x{}", hashFile.value(), source.area.position.x,
+                                         source.area.position.y, source.area.size.x, source.area.size.y));
+}
 
-    // Create inputImage from inputTexture
-    sf::Image inputImage{input.copyToImage()};
+std::optional<std::uint64_t> farcical::ResourceManager::GetCompositeKey(std::string_view description,
+                                                                        const std::vector<ResourceID>& inputIDs) {
+    if(!compositeCache.IsEnabled()) {
+        return std::nullopt;
+    } // if compositeCache is disabled
+    std::string keyBytes{description};
+    for(const auto& inputID: inputIDs) {
+        const auto& inputKey{GetTextureSourceKey(inputID)};
+        if(!inputKey.has_value()) {
+            return std::nullopt;
+        } // if input can't be identified
+        keyBytes += std::format("|{:016x}", inputKey.value());
+    } // for each inputID
+    return engine::HashBytes(keyBytes);
+}
 
-    // Grab a "slice" of the inputImage of the appropriate size
-    sf::Image slice{sliceSize};
-    const sf::IntRect sourceRect{
-            {0, 0},
-            {static_cast<int>(sliceSize.x), static_cast<int>(sliceSize.y)},
-        };
-    bool copySuccess{slice.copy(inputImage, sf::Vector2u{0, 0}, sourceRect)};
-    if(copySuccess) {
-        // Copy that slice at the end of each row
-        const sf::Texture sliceTexture{slice};
-        for(unsigned int x = 0; x < widthInTiles; ++x) {
-            const sf::Vector2u dest{
-                x * input.getSize().x,
-                input.getSize().y * heightInTiles
-            };
-            output.update(sliceTexture, dest);
-        } // for each row
-    } // if copySuccess
+sf::Texture* farcical::ResourceManager::ReadComposite(ResourceID id, std::optional<std::uint64_t> key) {
+    if(!key.has_value()) {
+        return nullptr;
+    } // if composite can't be cached
+    auto readTexture{compositeCache.Read(key.value())};
+    if(!readTexture.has_value()) {
+        if(logSystem) {
+            const engine::LogInterface log{*logSystem, "ResourceManager"};
+            FARCICAL_LOG_TRACE(log, "CompositeCache miss for {}: {}", id, readTexture.error().message);
+        } // if logSystem
+        return nullptr;
+    } // if readTexture == failure
+    const auto& insertTexture{textures.emplace(id, std::move(readTexture.value()))};
+    if(!insertTexture.second) {
+        return nullptr;
+    } // if insertTexture == failure
+    textureSources.insert_or_assign(id, TextureSource{"", {}, true, key});
+    if(logSystem) {
+        const engine::LogInterface log{*logSystem, "ResourceManager"};
+        FARCICAL_LOG_TRACE(log, "CompositeCache hit for {} ({:016x}).", id, key.value());
+    } // if logSystem
+    return &insertTexture.first->second;
+}
+
+void farcical::ResourceManager::WriteComposite(ResourceID id, std::optional<std::uint64_t> key,
+                                               const Compositor& compositor) {
+    textureSources.insert_or_assign(id, TextureSource{"", {}, true, key});
+    if(!key.has_value()) {
+        return;
+    } // if composite can't be cached
+    const Compositor::View pixels{compositor.GetView()};
+    const auto& writeTexture{compositeCache.Write(key.value(), pixels.size, pixels.pixels)};
+    if(writeTexture.has_value() && logSystem) {
+        const engine::LogInterface log{*logSystem, "ResourceManager"};
+        log.LogWarning("{}", writeTexture.value().message);
+    } // if writeTexture == failure
 }
@@ -64,19 +64,21 @@ void farcical::ui::Button::Controller::ReceiveKeyboardInput(sf::Keyboard::Key in
 
 farcical::ui::Button::Button(
     engine::EntityID id, const engine::Event::Parameters& onPress, engine::EventSystem& eventSystem,
+    engine::RenderSystem& renderSystem,
     Container* parent) : Widget(id, Widget::Type::Button, parent, true),
                          textures{nullptr},
                          status{Status::Normal},
                          onPressEvent{onPress},
-                         controller{std::make_unique<Button::Controller>(this, eventSystem)} {
+                         controller{std::make_unique<Button::Controller>(this, eventSystem)},
+                         renderSystem{renderSystem} {
 }
 
 void farcical::ui::Button::SetStatus(Status status) {
     this->status = status;
     engine::RenderComponent* renderCmp{
-        dynamic_cast<engine::RenderComponent*>(this->GetComponent(engine::Component::Type::Render))
+        renderSystem.GetRenderComponent(this->GetComponent(engine::Component::Type::Render))
     };
-    renderCmp->texture = this->textures[static_cast<int>(status)];
+    renderCmp->SetTexture(this->textures[static_cast<int>(status)]);
 }
 
 void farcical::ui::Button::SetTexture(Status status, sf::Texture& texture) {
@@ -11,7 +11,7 @@ std::expected<farcical::ui::WidgetProperties, farcical::engine::Error> farcical:
     properties.type = Widget::Type::Text;
     properties.parentID = parentID;
     /**********************     ID      **********************/
-    const auto& extractIDResult{ExtractWidgetID(json, parentID)};
+    const auto& extractIDResult{ExtractWidgetID(json, Widget::GetTypeName(properties.type))};
     if(!extractIDResult.has_value()) {
         return std::unexpected(extractIDResult.error());
     } // if extractIDResult == failure
@@ -129,8 +129,8 @@ std::expected<farcical::ui::WidgetProperties, farcical::engine::Error> farcical:
     return properties;
 }
 
-std::expected<farcical::ui::MenuProperties, farcical::engine::Error> farcical::ui::LoadMenu(const nlohmann::json& json,
-    engine::EntityID parentID) {
+std::expected<farcical::ui::MenuProperties, farcical::engine::Error> farcical::ui::LoadMenuHeader(
+    const nlohmann::json& json, engine::EntityID parentID) {
     MenuProperties properties;
     properties.type = Widget::Type::Menu;
     properties.parentID = parentID;
@@ -190,14 +190,6 @@ std::expected<farcical::ui::MenuProperties, farcical::engine::Error> farcical::u
         } // if extractTexturesResult == failure
         properties.buttonTextures = extractTexturesResult.value();
         /**********************     buttonTextures      **********************/
-
-        /**********************     buttonProperties      **********************/
-        const auto& extractPropertiesResult{ExtractButtonProperties(json, properties)};
-        if(!extractPositionResult.has_value()) {
-            return std::unexpected(extractPropertiesResult.error());
-        } // if extractPropertiesResult == failure
-        properties.buttonProperties = extractPropertiesResult.value();
-        /**********************     buttonProperties      **********************/
     } // if menuType == Button
     else if(properties.menuType == Menu::Type::RadioButton) {
         /**********************     radioButtonTextures      **********************/
@@ -207,7 +199,27 @@ std::expected<farcical::ui::MenuProperties, farcical::engine::Error> farcical::u
         } // if extractTexturesResult == failure
         properties.radioButtonTextures = extractTexturesResult.value();
         /**********************     radioButtonTextures      **********************/
+    } // else if menuType == RadioButton
+    return properties;
+}
 
+std::expected<farcical::ui::MenuProperties, farcical::engine::Error> farcical::ui::LoadMenu(const nlohmann::json& json,
+    engine::EntityID parentID) {
+    const auto& loadHeaderResult{LoadMenuHeader(json, parentID)};
+    if(!loadHeaderResult.has_value()) {
+        return std::unexpected(loadHeaderResult.error());
+    } // if loadHeaderResult == failure
+    MenuProperties properties{loadHeaderResult.value()};
+    if(properties.menuType == Menu::Type::Button) {
+        /**********************     buttonProperties      **********************/
+        const auto& extractPropertiesResult{ExtractButtonProperties(json, properties)};
+        if(!extractPropertiesResult.has_value()) {
+            return std::unexpected(extractPropertiesResult.error());
+        } // if extractPropertiesResult == failure
+        properties.buttonProperties = extractPropertiesResult.value();
+        /**********************     buttonProperties      **********************/
+    } // if menuType == Button
+    else if(properties.menuType == Menu::Type::RadioButton) {
         /**********************     radioButtonProperties      **********************/
         const auto& extractPropertiesResult{ExtractRadioButtonProperties(json, properties)};
         if(!extractPropertiesResult.has_value()) {
@@ -332,7 +344,7 @@ std::expected<farcical::ui::SceneProperties, farcical::engine::Error> farcical::
         const std::string failMsg{"Invalid configuration: No ID found for Scene."};
         return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
     } // if ID not found
-    properties.id = findID.value().get<std::string>();
+    properties.id = engine::EntityID{findID.value().get<std::string>()};
     /**********************     ID      **********************/
 
     /**********************     Music      **********************/
@@ -457,7 +469,7 @@ std::expected<farcical::engine::EntityID, farcical::engine::Error> farcical::ui:
         };
         return std::unexpected(engine::Error{engine::Error::Signal::InvalidConfiguration, failMsg});
     } // if WidgetID not found
-    return findID.value().get<engine::EntityID>();
+    return engine::EntityID{findID.value().get<std::string>()};
 }
 
 std::expected<farcical::ui::Widget::Type, farcical::engine::Error> farcical::ui::ExtractWidgetType(
@@ -0,0 +1,160 @@
+//
+// Created by dgmuller on 9/16/25.
+//
+
+#include <format>
+#include "../../include/ui/cookedAssets.hpp"
+#include "../../include/engine/hash.hpp"
+
+namespace {
+    // An input's path & content hash, so editing the image renames every composite drawn from it
+    std::string DescribeInput(farcical::ResourceManager& resourceManager, const std::string& path) {
+        const auto& hashFile{resourceManager.HashSourceFile(path)};
+        return hashFile.has_value() ? std::format("{}#{:016x}", path, hashFile.value()) : path + "#?";
+    }
+
+    std::string Describe(farcical::ResourceManager& resourceManager, const farcical::TextureProperties& properties) {
+        return std::format("{}@{},{}+{}x{}", DescribeInput(resourceManager, properties.path),
+                           properties.inputRect.position.x, properties.inputRect.position.y,
+                           properties.inputRect.size.x, properties.inputRect.size.y);
+    }
+
+    std::string Describe(farcical::ResourceManager& resourceManager,
+                         const farcical::RepeatingTextureProperties& properties) {
+        return std::format("repeating:{}@{},{}+{}x{}->{}x{}", DescribeInput(resourceManager, properties.path),
+                           properties.inputRect.position.x, properties.inputRect.position.y,
+                           properties.inputRect.size.x, properties.inputRect.size.y,
+                           properties.outputSize.x, properties.outputSize.y);
+    }
+
+    std::string Describe(farcical::ResourceManager& resourceManager,
+                         const farcical::SegmentedTextureProperties& properties) {
+        std::string description{"segmented:"};
+        for(const auto& segment: properties.segments) {
+            description += Describe(resourceManager, segment) + ";";
+        } // for each segment
+        return description;
+    }
+
+    // textureID is what CreateOverlayTexture will ask ResourceManager for, so match it the same way
+    std::string DescribeOverlayInput(farcical::ResourceManager& resourceManager,
+                                     const farcical::ResourceID& textureID,
+                                     const farcical::ui::SceneProperties& sceneProperties) {
+        for(const auto& segmented: sceneProperties.segmentedTextures) {
+            if(segmented.id + "Texture" == textureID) {
+                return Describe(resourceManager, segmented);
+            } // if input is this SegmentedTexture
+        } // for each SegmentedTexture
+        for(const auto& repeating: sceneProperties.repeatingTextures) {
+            if(repeating.outputID == textureID) {
+                return Describe(resourceManager, repeating);
+            } // if input is this RepeatingTexture
+        } // for each RepeatingTexture
+        for(const auto& texture: sceneProperties.textures) {
+            if(texture.id == textureID) {
+                return Describe(resourceManager, texture);
+            } // if input is this Texture
+        } // for each Texture
+        return textureID;
+    }
+
+    // The files DescribeOverlayInput's texture is drawn from, found the same way; nothing if it isn't in the Scene
+    void AppendOverlayInputPaths(const farcical::ResourceID& textureID,
+                                 const farcical::ui::SceneProperties& sceneProperties,
+                                 std::vector<std::string>& inputPaths) {
+        for(const auto& segmented: sceneProperties.segmentedTextures) {
+            if(segmented.id + "Texture" == textureID) {
+                for(const auto& segment: segmented.segments) {
+                    inputPaths.push_back(segment.path);
+                } // for each segment
+                return;
+            } // if input is this SegmentedTexture
+        } // for each SegmentedTexture
+        for(const auto& repeating: sceneProperties.repeatingTextures) {
+            if(repeating.outputID == textureID) {
+                inputPaths.push_back(repeating.path);
+                return;
+            } // if input is this RepeatingTexture
+        } // for each RepeatingTexture
+        for(const auto& texture: sceneProperties.textures) {
+            if(texture.id == textureID) {
+                inputPaths.push_back(texture.path);
+                return;
+            } // if input is this Texture
+        } // for each Texture
+    }
+}
+
+farcical::ui::CookedAssets::CookedAssets(std::string_view directory) : directory{directory} {
+}
+
+bool farcical::ui::CookedAssets::IsEnabled() const {
+    return !directory.empty();
+}
+
+std::string farcical::ui::CookedAssets::GetTexturePath(ResourceManager& resourceManager,
+                                                       const RepeatingTextureProperties& properties) const {
+    return GetTexturePath(properties.outputID, Describe(resourceManager, properties));
+}
+
+std::string farcical::ui::CookedAssets::GetTexturePath(ResourceManager& resourceManager,
+                                                       const SegmentedTextureProperties& properties) const {
+    return GetTexturePath(properties.id + "Texture", Describe(resourceManager, properties));
+}
+
+std::string farcical::ui::CookedAssets::GetTexturePath(ResourceManager& resourceManager,
+                                                       const OverlayTextureProperties& properties,
+                                                       const SceneProperties& sceneProperties) const {
+    const std::string description{
+        std::format("overlay:{}|{}|{}",
+                    DescribeOverlayInput(resourceManager, properties.baseTextureID + "Texture", sceneProperties),
+                    DescribeOverlayInput(resourceManager, properties.overlayTextureID + "Texture", sceneProperties),
+                    properties.opacity)
+    };
+    return GetTexturePath(properties.id + "Texture", description);
+}
+
+std::vector<std::string> farcical::ui::CookedAssets::GetInputPaths(const OverlayTextureProperties& properties,
+                                                                   const SceneProperties& sceneProperties) const {
+    std::vector<std::string> inputPaths;
+    AppendOverlayInputPaths(properties.baseTextureID + "Texture", sceneProperties, inputPaths);
+    AppendOverlayInputPaths(properties.overlayTextureID + "Texture", sceneProperties, inputPaths);
+    return inputPaths;
+}
+
+std::string farcical::ui::CookedAssets::GetTexturePath(ResourceManager& resourceManager,
+                                                       const BorderTextureProperties& properties,
+                                                       const sf::Vector2u& outputSize) const {
+    std::string description{"border:"};
+    for(const auto& corner: properties.cornerTextures) {
+        description += Describe(resourceManager, corner) + ";";
+    } // for each corner
+    for(const auto& edge: properties.edgeTextures) {
+        description += Describe(resourceManager, edge) + ";";
+    } // for each edge
+    description += std::format("{}->{}x{}", Describe(resourceManager, properties.centerTexture), outputSize.x,
+                               outputSize.y);
+    return GetTexturePath(properties.id, description);
+}
+
+std::string farcical::ui::CookedAssets::GetSceneCachePath() const {
+    return (directory / "scenes").generic_string();
+}
+
+std::string farcical::ui::CookedAssets::GetManifestPath(const engine::EntityID& sceneID) const {
+    return (directory / "manifests" / (sceneID.GetName() + ".json")).generic_string();
+}
+
+std::string farcical::ui::CookedAssets::GetTexturePath(const ResourceID& id, std::string_view description) const {
+    return (directory / "textures" / std::format("{}-{:016x}.png", id, engine::HashBytes(description))).generic_string();
+}
+
+sf::Vector2u farcical::ui::GetBorderTextureSize(const BorderTextureProperties& properties,
+                                                const sf::Vector2u& windowSize) {
+    return sf::Vector2u{
+        static_cast<unsigned int>(
+            static_cast<float>(properties.percentSize.x) * static_cast<float>(windowSize.x) / 100.0 / properties.scale),
+        static_cast<unsigned int>(
+            static_cast<float>(properties.percentSize.y) * static_cast<float>(windowSize.y) / 100.0 / properties.scale)
+    };
+}
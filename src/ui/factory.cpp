@@ -24,8 +24,9 @@ std::expected<farcical::ui::Decoration*, farcical::engine::Error> farcical::ui::
     // Create Decoration
     parent->AddChild(std::make_unique<Decoration>(properties.id, parent));
 
-    // Add its Texture
+    // Add its Texture, unless it is a Border drawn from its slices
     decoration = dynamic_cast<Decoration*>(parent->FindChild(properties.id));
+    const std::optional<engine::NineSlice> nineSlice{scene->GetCachedNineSlice(properties.textureProperties.id)};
     sf::Texture* texture{scene->GetCachedTexture(properties.textureProperties.id)};
     decoration->SetTexture(texture);
 
@@ -34,10 +35,10 @@ std::expected<farcical::ui::Decoration*, farcical::engine::Error> farcical::ui::
         scene->GetCachedTextureProperties(properties.textureProperties.id)
     };
     decoration->SetScale(sf::Vector2f{textureProperties.scale, textureProperties.scale});
-    sf::Sprite tempSprite{*texture};
+    const sf::Vector2f unscaledSize{nineSlice.has_value() ? nineSlice->size : sf::Vector2f{texture->getSize()}};
     decoration->SetSize(sf::Vector2u{
-        static_cast<unsigned int>(tempSprite.getGlobalBounds().size.x * textureProperties.scale),
-        static_cast<unsigned int>(tempSprite.getGlobalBounds().size.y * textureProperties.scale)
+        static_cast<unsigned int>(unscaledSize.x * textureProperties.scale),
+        static_cast<unsigned int>(unscaledSize.y * textureProperties.scale)
     });
 
     const auto& windowSize{renderSystem.GetWindow().getSize()};
@@ -52,17 +53,23 @@ std::expected<farcical::ui::Decoration*, farcical::engine::Error> farcical::ui::
     } // if relativePosition != (0, 0)
 
     const auto& createRenderCmp{
-        renderSystem.CreateRenderComponent(
-            properties.layerID,
-            scene->GetID(),
-            decoration->GetID(),
-            decoration->GetTexture())
+        nineSlice.has_value()
+            ? renderSystem.CreateRenderComponent(
+                properties.layerID,
+                scene->GetID(),
+                decoration->GetID(),
+                nineSlice.value())
+            : renderSystem.CreateRenderComponent(
+                properties.layerID,
+                scene->GetID(),
+                decoration->GetID(),
+                decoration->GetTexture())
     };
     if(createRenderCmp.has_value()) {
-        engine::RenderComponent* renderCmp{createRenderCmp.value()};
-        renderCmp->scale = decoration->GetScale();
-        renderCmp->position = decoration->GetPosition();
-        decoration->AddComponent(renderCmp);
+        engine::RenderComponent* renderCmp{renderSystem.GetRenderComponent(createRenderCmp.value())};
+        renderCmp->SetScale(decoration->GetScale());
+        renderCmp->SetPosition(decoration->GetPosition());
+        decoration->AddComponent(engine::Component::Type::Render, createRenderCmp.value());
     } // if createRenderCmp == success
 
     return decoration;
@@ -96,7 +103,7 @@ std::expected<farcical::ui::Text*, farcical::engine::Error> farcical::ui::factor
     } // if parent not found
 
     // Create Text
-    parent->AddChild(std::make_unique<Text>(properties.id, parent));
+    parent->AddChild(std::make_unique<Text>(properties.id, renderSystem, parent));
 
     // Add its Font
     text = dynamic_cast<Text*>(parent->FindChild(properties.id));
@@ -106,12 +113,29 @@ std::expected<farcical::ui::Text*, farcical::engine::Error> farcical::ui::factor
 
     // Configure its properties
     text->SetFontProperties(fontProperties);
+
+    // Create its RenderComponent up front, so the retained sf::Text it draws with is also used for measurement
+    const auto& createRenderCmp{
+        renderSystem.CreateRenderComponent(
+            properties.layerID,
+            scene->GetID(),
+            text->GetID(),
+            text->GetFont(),
+            text->GetFontProperties(),
+            properties.labelProperties.first)
+    };
+    if(!createRenderCmp.has_value()) {
+        return std::unexpected(createRenderCmp.error());
+    } // if createRenderCmp == failure
+    text->AddComponent(engine::Component::Type::Render, createRenderCmp.value());
+    engine::RenderComponent* renderCmp{renderSystem.GetRenderComponent(createRenderCmp.value())};
+
     text->SetContents(properties.labelProperties.first);
     text->SetScale(sf::Vector2f{properties.labelProperties.second.scale, properties.labelProperties.second.scale});
-    const sf::Text tempText{*font, properties.labelProperties.first, fontProperties.characterSize};
+    const sf::FloatRect textBounds{renderCmp->GetText()->getLocalBounds()};
     text->SetSize(sf::Vector2u{
-        static_cast<unsigned int>(tempText.getGlobalBounds().size.x * fontProperties.scale),
-        static_cast<unsigned int>(tempText.getGlobalBounds().size.y * fontProperties.scale)
+        static_cast<unsigned int>(textBounds.size.x * fontProperties.scale),
+        static_cast<unsigned int>(textBounds.size.y * fontProperties.scale)
     });
     if(bounds.size.x > 0 && bounds.size.y > 0) {
         text->SetPosition(sf::Vector2f{
@@ -127,22 +151,8 @@ std::expected<farcical::ui::Text*, farcical::engine::Error> farcical::ui::factor
             static_cast<float>(properties.relativePosition.y * windowSize.y) / 100.0f
         });
     }
-
-    const auto& createRenderCmp{
-        renderSystem.CreateRenderComponent(
-            properties.layerID,
-            scene->GetID(),
-            text->GetID(),
-            text->GetFont(),
-            text->GetFontProperties(),
-            text->GetContents())
-    };
-    if(createRenderCmp.has_value()) {
-        engine::RenderComponent* renderCmp{createRenderCmp.value()};
-        renderCmp->scale = text->GetScale();
-        renderCmp->position = text->GetPosition();
-        text->AddComponent(renderCmp);
-    } // if createRenderCmp == success
+    renderCmp->SetScale(text->GetScale());
+    renderCmp->SetPosition(text->GetPosition());
 
     return text;
 }
@@ -191,7 +201,7 @@ std::expected<farcical::ui::Menu*, farcical::engine::Error> farcical::ui::factor
 
             // Create Label
             const WidgetProperties labelProperties{
-                buttonProperties.id + "Label",
+                engine::EntityID{buttonProperties.id + "Label"},
                 Widget::Type::Text,
                 properties.id,
                 Layout::Layer::ID::Foreground,
@@ -230,7 +240,7 @@ std::expected<farcical::ui::Menu*, farcical::engine::Error> farcical::ui::factor
 
             // Create Label
             const WidgetProperties labelProperties{
-                radioButtonProperties.id + "Label",
+                engine::EntityID{radioButtonProperties.id + "Label"},
                 Widget::Type::Text,
                 properties.id,
                 Layout::Layer::ID::Foreground,
@@ -258,9 +268,9 @@ std::expected<farcical::ui::Menu*, farcical::engine::Error> farcical::ui::factor
             };
             label->SetPosition(labelPosition);
             engine::RenderComponent* renderCmp{
-                dynamic_cast<engine::RenderComponent*>(label->GetComponent(engine::Component::Type::Render))
+                renderSystem.GetRenderComponent(label->GetComponent(engine::Component::Type::Render))
             };
-            renderCmp->position = labelPosition;
+            renderCmp->SetPosition(labelPosition);
         } // for each RadioButton in Menu
     } // else if RadioButton Menu
 
@@ -358,7 +368,7 @@ std::expected<farcical::ui::Button*, farcical::engine::Error> farcical::ui::fact
 
     // Create Button
     engine::EntityID buttonID{buttonProperties.id + "Button"};
-    menu->AddChild(std::make_unique<Button>(buttonID, buttonProperties.onPressEvent, eventSystem, menu));
+    menu->AddChild(std::make_unique<Button>(buttonID, buttonProperties.onPressEvent, eventSystem, renderSystem, menu));
     Button* button{dynamic_cast<Button*>(menu->FindChild(buttonID))};
 
     // Get Button index
@@ -425,10 +435,10 @@ std::expected<farcical::ui::Button*, farcical::engine::Error> farcical::ui::fact
             button->GetTexture())
     };
     if(createRenderCmp.has_value()) {
-        engine::RenderComponent* renderCmp{createRenderCmp.value()};
-        renderCmp->scale = button->GetScale();
-        renderCmp->position = button->GetPosition();
-        button->AddComponent(renderCmp);
+        engine::RenderComponent* renderCmp{renderSystem.GetRenderComponent(createRenderCmp.value())};
+        renderCmp->SetScale(button->GetScale());
+        renderCmp->SetPosition(button->GetPosition());
+        button->AddComponent(engine::Component::Type::Render, createRenderCmp.value());
     } // if createRenderCmp == success
     else {
         const std::string failMsg{
@@ -439,11 +449,10 @@ std::expected<farcical::ui::Button*, farcical::engine::Error> farcical::ui::fact
 
     Button::Controller* controller{button->GetController()};
     const auto& createInputCmp{
-        inputSystem.CreateInputComponent(controller, controller, button->GetID())
+        inputSystem.CreateInputComponent(controller, controller, button->GetID(), button->GetBounds())
     };
     if(createInputCmp.has_value()) {
-        engine::InputComponent* inputCmp{createInputCmp.value()};
-        button->AddComponent(inputCmp);
+        button->AddComponent(engine::Component::Type::Input, createInputCmp.value());
     } // if createInputCmp == success
     else {
         const std::string failMsg{
@@ -469,7 +478,7 @@ std::expected<farcical::ui::RadioButton*, farcical::engine::Error> farcical::ui:
 
     // Create RadioButton
     engine::EntityID radioButtonID{radioButtonProperties.id + "RadioButton"};
-    menu->AddChild(std::make_unique<RadioButton>(radioButtonID, eventSystem, menu));
+    menu->AddChild(std::make_unique<RadioButton>(radioButtonID, eventSystem, renderSystem, menu));
     RadioButton* radioButton{dynamic_cast<RadioButton*>(menu->FindChild(radioButtonID))};
 
     // Get RadioButton index
@@ -536,19 +545,18 @@ std::expected<farcical::ui::RadioButton*, farcical::engine::Error> farcical::ui:
             radioButton->GetTexture())
     };
     if(createRenderCmp.has_value()) {
-        engine::RenderComponent* renderCmp{createRenderCmp.value()};
-        renderCmp->scale = radioButton->GetScale();
-        renderCmp->position = radioButton->GetPosition();
-        radioButton->AddComponent(renderCmp);
+        engine::RenderComponent* renderCmp{renderSystem.GetRenderComponent(createRenderCmp.value())};
+        renderCmp->SetScale(radioButton->GetScale());
+        renderCmp->SetPosition(radioButton->GetPosition());
+        radioButton->AddComponent(engine::Component::Type::Render, createRenderCmp.value());
     } // if createRenderCmp == success
 
     RadioButton::Controller* controller{radioButton->GetController()};
     const auto& createInputCmp{
-        inputSystem.CreateInputComponent(controller, controller, radioButton->GetID())
+        inputSystem.CreateInputComponent(controller, controller, radioButton->GetID(), radioButton->GetBounds())
     };
     if(createInputCmp.has_value()) {
-        engine::InputComponent* inputCmp{createInputCmp.value()};
-        radioButton->AddComponent(inputCmp);
+        radioButton->AddComponent(engine::Component::Type::Input, createInputCmp.value());
     } // if createInputCmp == success
     else {
         const std::string failMsg{
@@ -2,7 +2,8 @@
 // Created by dgmuller on 7/27/25.
 //
 #include "../../include/ui/radio.hpp"
-#include "../../include/engine/component/render.hpp"
+#include "../../include/ui/container.hpp"
+#include "../../include/engine/system/render.hpp"
 
 farcical::ui::RadioButton::Controller::Controller(RadioButton* radioButton,
                                                   engine::EventSystem& eventSystem) : KeyboardInterface(),
@@ -32,23 +33,34 @@ void farcical::ui::RadioButton::Controller::ReceiveMouseButtonRelease(sf::Mouse:
     const auto& bounds{radioButton->GetBounds()};
     if(mouseButton == sf::Mouse::Button::Left) {
         if(IsPointWithinRect(position, bounds)) {
+            // Clicks are only delivered to the widgets under the cursor, so the selected RadioButton deselects the
+            // rest of its group itself
+            const Container* group{radioButton->GetParent()};
+            if(group) {
+                for(const auto& sibling: group->GetChildren()) {
+                    if(sibling != radioButton && sibling->GetType() == Widget::Type::RadioButton) {
+                        sibling->DoAction(Action{Action::Type::SetPressedFalse});
+                    } // if sibling is another RadioButton
+                } // for each sibling in group
+            } // if group
             radioButton->DoAction(Action{Action::Type::SetPressedTrue});
         } // if cursor position is within bounds
-        else {
-            radioButton->DoAction(Action{Action::Type::SetPressedFalse});
-        } // else
     } // if Left-Click
 }
 
 void farcical::ui::RadioButton::Controller::ReceiveKeyboardInput(sf::Keyboard::Key input) {
 }
 
-farcical::ui::RadioButton::RadioButton(engine::EntityID id, engine::EventSystem& eventSystem, Container* parent):
+farcical::ui::RadioButton::RadioButton(engine::EntityID id,
+                                       engine::EventSystem& eventSystem,
+                                       engine::RenderSystem& renderSystem,
+                                       Container* parent):
     Widget(id, Type::RadioButton, parent, true),
     Focusable(),
     textures{nullptr},
     status{Status::Off},
-    controller{std::make_unique<RadioButton::Controller>(this, eventSystem)} {
+    controller{std::make_unique<RadioButton::Controller>(this, eventSystem)},
+    renderSystem{renderSystem} {
 }
 
 void farcical::ui::RadioButton::SetTexture(Status state, sf::Texture& texture) {
@@ -70,9 +82,9 @@ farcical::ui::RadioButton::Status farcical::ui::RadioButton::GetStatus() const {
 void farcical::ui::RadioButton::SetStatus(Status status) {
     this->status = status;
     engine::RenderComponent* renderCmp{
-        dynamic_cast<engine::RenderComponent*>(this->GetComponent(engine::Component::Type::Render))
+        renderSystem.GetRenderComponent(this->GetComponent(engine::Component::Type::Render))
     };
-    renderCmp->texture = this->textures[static_cast<int>(status)];
+    renderCmp->SetTexture(this->textures[static_cast<int>(status)]);
 }
 
 void farcical::ui::RadioButton::DoAction(Action action) {
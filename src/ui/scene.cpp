@@ -66,8 +66,14 @@ void farcical::ui::Scene::HandleEvent(const engine::Event& event) {
     if(event.type == engine::Event::Type::SetFocus) {
         Widget* focus{nullptr};
         if(!event.args.empty()) {
-            const ResourceID widgetID{std::any_cast<std::string>(event.args.at(0))};
-            focus = this->FindChild(widgetID);
+            const std::any& arg{event.args.at(0)};
+            // A name that was never interned can't belong to any widget
+            const std::optional<engine::EntityID> widgetID{
+                arg.type() == typeid(engine::EntityID)
+                    ? std::any_cast<engine::EntityID>(arg)
+                    : engine::EntityID::Find(std::any_cast<const std::string&>(arg))
+            };
+            focus = widgetID.has_value() ? this->FindChild(widgetID.value()) : nullptr;
             if(focus) {
                 SetFocusedWidget(focus);
             } // if widget
@@ -123,6 +129,14 @@ farcical::TextureProperties farcical::ui::Scene::GetCachedTextureProperties(Reso
     return TextureProperties{};
 }
 
+std::optional<farcical::engine::NineSlice> farcical::ui::Scene::GetCachedNineSlice(ResourceID id) const {
+    const auto& findNineSlice{nineSliceCache.find(id)};
+    if(findNineSlice != nineSliceCache.end()) {
+        return findNineSlice->second;
+    }
+    return std::nullopt;
+}
+
 void farcical::ui::Scene::CacheMusic(ResourceID id, sf::Music* music) {
     musicCache.emplace(id, music);
 }
@@ -147,6 +161,10 @@ void farcical::ui::Scene::CacheTextureProperties(ResourceID id, const TexturePro
     texturePropertiesCache.emplace(id, textureProperties);
 }
 
+void farcical::ui::Scene::CacheNineSlice(ResourceID id, const engine::NineSlice& nineSlice) {
+    nineSliceCache.emplace(id, nineSlice);
+}
+
 void farcical::ui::Scene::ClearMusicCache() {
     musicCache.clear();
 }
@@ -171,6 +189,10 @@ void farcical::ui::Scene::ClearTexturePropertiesCache() {
     texturePropertiesCache.clear();
 }
 
+void farcical::ui::Scene::ClearNineSliceCache() {
+    nineSliceCache.clear();
+}
+
 /*
 std::expected<farcical::ui::MenuController*, farcical::engine::Error> farcical::ui::Scene::CreateMenuController(
     Menu* menu, engine::EventSystem& eventSystem) {
@@ -0,0 +1,658 @@
+//
+// Created by dgmuller on 9/13/25.
+//
+
+#include <any>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+#include "../../include/ui/sceneCache.hpp"
+#include "../../include/engine/hash.hpp"
+#include "../../include/engine/profiler.hpp"
+
+namespace {
+    // Everything is written in the machine's own byte order; the cache never leaves the machine that built it
+    class Writer {
+    public:
+        template<typename T> requires std::is_arithmetic_v<T>
+        void PutValue(T value) {
+            const auto* bytes{reinterpret_cast<const char*>(&value)};
+            buffer.append(bytes, sizeof(T));
+        }
+
+        void PutString(std::string_view value) {
+            PutValue(static_cast<std::uint32_t>(value.size()));
+            buffer.append(value);
+        }
+
+        std::string buffer;
+        bool isValid{true};
+    };
+
+    class Reader {
+    public:
+        explicit Reader(std::string_view data) : data{data} {
+        }
+
+        template<typename T> requires std::is_arithmetic_v<T>
+        void GetValue(T& value) {
+            if(!isValid || data.size() - offset < sizeof(T)) {
+                isValid = false;
+                return;
+            } // if there are not enough bytes left
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+            offset += sizeof(T);
+        }
+
+        void GetString(std::string& value) {
+            std::uint32_t length{0};
+            GetValue(length);
+            if(!isValid || data.size() - offset < length) {
+                isValid = false;
+                return;
+            } // if there are not enough bytes left
+            value.assign(data.substr(offset, length));
+            offset += length;
+        }
+
+        // Read a count of elements, each at least minSize bytes; a corrupt count can't ask for more than is left
+        std::uint32_t GetCount(std::size_t minSize = 1) {
+            std::uint32_t count{0};
+            GetValue(count);
+            if(!isValid || count > (data.size() - offset) / minSize) {
+                isValid = false;
+                return 0;
+            } // if count can't possibly fit
+            return count;
+        }
+
+        std::string_view data;
+        std::size_t offset{0};
+        bool isValid{true};
+    };
+
+    template<typename Enum> requires std::is_enum_v<Enum>
+    void Put(Writer& writer, Enum value) {
+        writer.PutValue(static_cast<std::int32_t>(value));
+    }
+
+    template<typename Enum> requires std::is_enum_v<Enum>
+    void Get(Reader& reader, Enum& value) {
+        std::int32_t rawValue{0};
+        reader.GetValue(rawValue);
+        value = static_cast<Enum>(rawValue);
+    }
+
+    void Put(Writer& writer, const farcical::engine::EntityID& id) {
+        writer.PutString(id.GetName());
+    }
+
+    void Get(Reader& reader, farcical::engine::EntityID& id) {
+        std::string name;
+        reader.GetString(name);
+        id = farcical::engine::EntityID{name};
+    }
+
+    void Put(Writer& writer, const sf::Color& color) {
+        writer.PutValue(color.r);
+        writer.PutValue(color.g);
+        writer.PutValue(color.b);
+        writer.PutValue(color.a);
+    }
+
+    void Get(Reader& reader, sf::Color& color) {
+        reader.GetValue(color.r);
+        reader.GetValue(color.g);
+        reader.GetValue(color.b);
+        reader.GetValue(color.a);
+    }
+
+    template<typename T>
+    void Put(Writer& writer, const sf::Vector2<T>& vector) {
+        writer.PutValue(vector.x);
+        writer.PutValue(vector.y);
+    }
+
+    template<typename T>
+    void Get(Reader& reader, sf::Vector2<T>& vector) {
+        reader.GetValue(vector.x);
+        reader.GetValue(vector.y);
+    }
+
+    void Put(Writer& writer, const sf::IntRect& rect) {
+        Put(writer, rect.position);
+        Put(writer, rect.size);
+    }
+
+    void Get(Reader& reader, sf::IntRect& rect) {
+        Get(reader, rect.position);
+        Get(reader, rect.size);
+    }
+
+    template<typename T>
+    void Put(Writer& writer, const std::vector<T>& values) {
+        writer.PutValue(static_cast<std::uint32_t>(values.size()));
+        for(const auto& value: values) {
+            Put(writer, value);
+        } // for each value
+    }
+
+    template<typename T>
+    void Get(Reader& reader, std::vector<T>& values) {
+        const std::uint32_t count{reader.GetCount()};
+        values.clear();
+        values.reserve(count);
+        for(std::uint32_t index = 0; index < count && reader.isValid; ++index) {
+            Get(reader, values.emplace_back());
+        } // for each value
+    }
+
+    template<typename T, std::size_t Size>
+    void Put(Writer& writer, const std::array<T, Size>& values) {
+        for(const auto& value: values) {
+            Put(writer, value);
+        } // for each value
+    }
+
+    template<typename T, std::size_t Size>
+    void Get(Reader& reader, std::array<T, Size>& values) {
+        for(auto& value: values) {
+            Get(reader, value);
+        } // for each value
+    }
+
+    template<typename First, typename Second>
+    void Put(Writer& writer, const std::pair<First, Second>& pair) {
+        Put(writer, pair.first);
+        Put(writer, pair.second);
+    }
+
+    template<typename First, typename Second>
+    void Get(Reader& reader, std::pair<First, Second>& pair) {
+        Get(reader, pair.first);
+        Get(reader, pair.second);
+    }
+
+    void Put(Writer& writer, const std::string& value) {
+        writer.PutString(value);
+    }
+
+    void Get(Reader& reader, std::string& value) {
+        reader.GetString(value);
+    }
+
+    void Put(Writer& writer, const farcical::ResourceProperties& properties) {
+        writer.PutString(properties.id);
+        Put(writer, properties.type);
+        writer.PutString(properties.path);
+        writer.PutValue(properties.persist);
+    }
+
+    void Get(Reader& reader, farcical::ResourceProperties& properties) {
+        reader.GetString(properties.id);
+        Get(reader, properties.type);
+        reader.GetString(properties.path);
+        reader.GetValue(properties.persist);
+    }
+
+    void Put(Writer& writer, const farcical::MusicProperties& properties) {
+        Put(writer, static_cast<const farcical::ResourceProperties&>(properties));
+        writer.PutValue(properties.loop);
+        writer.PutValue(properties.volume);
+    }
+
+    void Get(Reader& reader, farcical::MusicProperties& properties) {
+        Get(reader, static_cast<farcical::ResourceProperties&>(properties));
+        reader.GetValue(properties.loop);
+        reader.GetValue(properties.volume);
+    }
+
+    void Put(Writer& writer, const farcical::FontProperties& properties) {
+        Put(writer, static_cast<const farcical::ResourceProperties&>(properties));
+        writer.PutValue(properties.scale);
+        writer.PutValue(properties.characterSize);
+        Put(writer, properties.color);
+        Put(writer, properties.outlineColor);
+        writer.PutValue(properties.outlineThickness);
+    }
+
+    void Get(Reader& reader, farcical::FontProperties& properties) {
+        Get(reader, static_cast<farcical::ResourceProperties&>(properties));
+        reader.GetValue(properties.scale);
+        reader.GetValue(properties.characterSize);
+        Get(reader, properties.color);
+        Get(reader, properties.outlineColor);
+        reader.GetValue(properties.outlineThickness);
+    }
+
+    void Put(Writer& writer, const farcical::TextureProperties& properties) {
+        Put(writer, static_cast<const farcical::ResourceProperties&>(properties));
+        writer.PutValue(properties.scale);
+        Put(writer, properties.color);
+        writer.PutValue(properties.isColorized);
+        Put(writer, properties.inputRect);
+    }
+
+    void Get(Reader& reader, farcical::TextureProperties& properties) {
+        Get(reader, static_cast<farcical::ResourceProperties&>(properties));
+        reader.GetValue(properties.scale);
+        Get(reader, properties.color);
+        reader.GetValue(properties.isColorized);
+        Get(reader, properties.inputRect);
+    }
+
+    void Put(Writer& writer, const farcical::RepeatingTextureProperties& properties) {
+        Put(writer, static_cast<const farcical::ResourceProperties&>(properties));
+        writer.PutString(properties.inputID);
+        writer.PutString(properties.outputID);
+        writer.PutValue(properties.scale);
+        Put(writer, properties.color);
+        writer.PutValue(properties.isColorized);
+        Put(writer, properties.inputRect);
+        Put(writer, properties.outputSize);
+    }
+
+    void Get(Reader& reader, farcical::RepeatingTextureProperties& properties) {
+        Get(reader, static_cast<farcical::ResourceProperties&>(properties));
+        reader.GetString(properties.inputID);
+        reader.GetString(properties.outputID);
+        reader.GetValue(properties.scale);
+        Get(reader, properties.color);
+        reader.GetValue(properties.isColorized);
+        Get(reader, properties.inputRect);
+        Get(reader, properties.outputSize);
+    }
+
+    void Put(Writer& writer, const farcical::SegmentedTextureProperties& properties) {
+        Put(writer, static_cast<const farcical::ResourceProperties&>(properties));
+        writer.PutValue(properties.scale);
+        Put(writer, properties.color);
+        writer.PutValue(properties.isColorized);
+        Put(writer, properties.outputSize);
+        Put(writer, properties.segments);
+    }
+
+    void Get(Reader& reader, farcical::SegmentedTextureProperties& properties) {
+        Get(reader, static_cast<farcical::ResourceProperties&>(properties));
+        reader.GetValue(properties.scale);
+        Get(reader, properties.color);
+        reader.GetValue(properties.isColorized);
+        Get(reader, properties.outputSize);
+        Get(reader, properties.segments);
+    }
+
+    void Put(Writer& writer, const farcical::OverlayTextureProperties& properties) {
+        Put(writer, static_cast<const farcical::ResourceProperties&>(properties));
+        writer.PutString(properties.baseTextureID);
+        writer.PutString(properties.overlayTextureID);
+        writer.PutValue(properties.opacity);
+    }
+
+    void Get(Reader& reader, farcical::OverlayTextureProperties& properties) {
+        Get(reader, static_cast<farcical::ResourceProperties&>(properties));
+        reader.GetString(properties.baseTextureID);
+        reader.GetString(properties.overlayTextureID);
+        reader.GetValue(properties.opacity);
+    }
+
+    void Put(Writer& writer, const farcical::BorderTextureProperties& properties) {
+        Put(writer, static_cast<const farcical::ResourceProperties&>(properties));
+        writer.PutValue(properties.scale);
+        Put(writer, properties.percentSize);
+        writer.PutValue(properties.isNineSlice);
+        Put(writer, properties.cornerTextures);
+        Put(writer, properties.edgeTextures);
+        Put(writer, properties.centerTexture);
+    }
+
+    void Get(Reader& reader, farcical::BorderTextureProperties& properties) {
+        Get(reader, static_cast<farcical::ResourceProperties&>(properties));
+        reader.GetValue(properties.scale);
+        Get(reader, properties.percentSize);
+        reader.GetValue(properties.isNineSlice);
+        Get(reader, properties.cornerTextures);
+        Get(reader, properties.edgeTextures);
+        Get(reader, properties.centerTexture);
+    }
+
+    // Button events carry the same argument types ExtractButtonEvent produces
+    enum class ArgType : std::uint8_t {
+        String,
+        Bool,
+        Float,
+        Int
+    };
+
+    void Put(Writer& writer, const std::any& arg) {
+        if(const auto* stringArg = std::any_cast<std::string>(&arg)) {
+            writer.PutValue(static_cast<std::uint8_t>(ArgType::String));
+            writer.PutString(*stringArg);
+        } // if arg is a string
+        else if(const auto* boolArg = std::any_cast<bool>(&arg)) {
+            writer.PutValue(static_cast<std::uint8_t>(ArgType::Bool));
+            writer.PutValue(*boolArg);
+        } // else if arg is a bool
+        else if(const auto* floatArg = std::any_cast<float>(&arg)) {
+            writer.PutValue(static_cast<std::uint8_t>(ArgType::Float));
+            writer.PutValue(*floatArg);
+        } // else if arg is a float
+        else if(const auto* intArg = std::any_cast<int>(&arg)) {
+            writer.PutValue(static_cast<std::uint8_t>(ArgType::Int));
+            writer.PutValue(*intArg);
+        } // else if arg is an int
+        else {
+            writer.isValid = false;
+        } // else arg can't be cached
+    }
+
+    void Get(Reader& reader, std::any& arg) {
+        std::uint8_t argType{0};
+        reader.GetValue(argType);
+        switch(static_cast<ArgType>(argType)) {
+            case ArgType::String: {
+                std::string value;
+                reader.GetString(value);
+                arg = value;
+            }
+            break;
+            case ArgType::Bool: {
+                bool value{false};
+                reader.GetValue(value);
+                arg = value;
+            }
+            break;
+            case ArgType::Float: {
+                float value{0.0f};
+                reader.GetValue(value);
+                arg = value;
+            }
+            break;
+            case ArgType::Int: {
+                int value{0};
+                reader.GetValue(value);
+                arg = value;
+            }
+            break;
+            default: {
+                reader.isValid = false;
+            }
+        } // switch argType
+    }
+
+    void Put(Writer& writer, const farcical::ui::WidgetProperties& properties) {
+        Put(writer, properties.id);
+        Put(writer, properties.type);
+        Put(writer, properties.parentID);
+        Put(writer, properties.layerID);
+        Put(writer, properties.relativePosition);
+        writer.PutString(properties.labelProperties.first);
+        Put(writer, properties.labelProperties.second);
+    }
+
+    void Get(Reader& reader, farcical::ui::WidgetProperties& properties) {
+        Get(reader, properties.id);
+        Get(reader, properties.type);
+        Get(reader, properties.parentID);
+        Get(reader, properties.layerID);
+        Get(reader, properties.relativePosition);
+        reader.GetString(properties.labelProperties.first);
+        Get(reader, properties.labelProperties.second);
+    }
+
+    void Put(Writer& writer, const farcical::ui::DecorationProperties& properties) {
+        Put(writer, static_cast<const farcical::ui::WidgetProperties&>(properties));
+        Put(writer, properties.textureProperties);
+    }
+
+    void Get(Reader& reader, farcical::ui::DecorationProperties& properties) {
+        Get(reader, static_cast<farcical::ui::WidgetProperties&>(properties));
+        Get(reader, properties.textureProperties);
+    }
+
+    void Put(Writer& writer, const farcical::ui::ButtonProperties& properties) {
+        Put(writer, static_cast<const farcical::ui::WidgetProperties&>(properties));
+        Put(writer, properties.onPressEvent.type);
+        Put(writer, properties.onPressEvent.args);
+    }
+
+    void Get(Reader& reader, farcical::ui::ButtonProperties& properties) {
+        Get(reader, static_cast<farcical::ui::WidgetProperties&>(properties));
+        Get(reader, properties.onPressEvent.type);
+        Get(reader, properties.onPressEvent.args);
+    }
+
+    void Put(Writer& writer, const farcical::ui::MenuLayout& layout) {
+        Put(writer, layout.orientation);
+        writer.PutValue(layout.relativeSpacing);
+        writer.PutValue(static_cast<std::uint32_t>(layout.positions.size()));
+        for(const auto& [id, position]: layout.positions) {
+            Put(writer, id);
+            Put(writer, position);
+        } // for each position
+    }
+
+    void Get(Reader& reader, farcical::ui::MenuLayout& layout) {
+        Get(reader, layout.orientation);
+        reader.GetValue(layout.relativeSpacing);
+        const std::uint32_t count{reader.GetCount()};
+        layout.positions.clear();
+        for(std::uint32_t index = 0; index < count && reader.isValid; ++index) {
+            farcical::engine::EntityID id;
+            sf::Vector2f position;
+            Get(reader, id);
+            Get(reader, position);
+            layout.positions.insert_or_assign(id, position);
+        } // for each position
+    }
+
+    void Put(Writer& writer, const farcical::ui::MenuProperties& properties) {
+        Put(writer, static_cast<const farcical::ui::WidgetProperties&>(properties));
+        Put(writer, properties.menuType);
+        Put(writer, properties.layout);
+        Put(writer, properties.buttonTextures);
+        Put(writer, properties.radioButtonTextures);
+        Put(writer, properties.buttonProperties);
+        Put(writer, properties.radioButtonProperties);
+        Put(writer, properties.menuProperties);
+    }
+
+    void Get(Reader& reader, farcical::ui::MenuProperties& properties) {
+        Get(reader, static_cast<farcical::ui::WidgetProperties&>(properties));
+        Get(reader, properties.menuType);
+        Get(reader, properties.layout);
+        Get(reader, properties.buttonTextures);
+        Get(reader, properties.radioButtonTextures);
+        Get(reader, properties.buttonProperties);
+        Get(reader, properties.radioButtonProperties);
+        Get(reader, properties.menuProperties);
+    }
+
+    void Put(Writer& writer, const farcical::ui::LayoutLayerProperties& properties) {
+        Put(writer, properties.id);
+        Put(writer, properties.decorationProperties);
+        Put(writer, properties.titleProperties);
+        Put(writer, properties.headingProperties);
+        Put(writer, properties.menuProperties);
+    }
+
+    void Get(Reader& reader, farcical::ui::LayoutLayerProperties& properties) {
+        Get(reader, properties.id);
+        Get(reader, properties.decorationProperties);
+        Get(reader, properties.titleProperties);
+        Get(reader, properties.headingProperties);
+        Get(reader, properties.menuProperties);
+    }
+
+    void Put(Writer& writer, const farcical::ui::SceneProperties& properties) {
+        Put(writer, properties.id);
+        Put(writer, properties.music);
+        Put(writer, properties.fonts);
+        Put(writer, properties.textures);
+        Put(writer, properties.repeatingTextures);
+        Put(writer, properties.segmentedTextures);
+        Put(writer, properties.overlayTextures);
+        Put(writer, properties.borderTexture);
+        Put(writer, properties.layout.layers);
+    }
+
+    void Get(Reader& reader, farcical::ui::SceneProperties& properties) {
+        Get(reader, properties.id);
+        Get(reader, properties.music);
+        Get(reader, properties.fonts);
+        Get(reader, properties.textures);
+        Get(reader, properties.repeatingTextures);
+        Get(reader, properties.segmentedTextures);
+        Get(reader, properties.overlayTextures);
+        Get(reader, properties.borderTexture);
+        Get(reader, properties.layout.layers);
+    }
+
+    std::optional<std::string> ReadWholeFile(const std::filesystem::path& path) {
+        std::ifstream input{path, std::ios_base::in | std::ios_base::binary};
+        if(!input.is_open()) {
+            return std::nullopt;
+        } // if file could not be opened
+        return std::string{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+    }
+
+    std::int64_t GetModifiedTime(const std::filesystem::path& path, std::error_code& errorCode) {
+        return std::filesystem::last_write_time(path, errorCode).time_since_epoch().count();
+    }
+}
+
+farcical::ui::SceneCache::SceneCache(std::string_view directory) : directory{directory} {
+}
+
+bool farcical::ui::SceneCache::IsEnabled() const {
+    return !directory.empty();
+}
+
+std::expected<farcical::ui::SceneProperties, farcical::engine::Error> farcical::ui::SceneCache::Read(
+    std::string_view sourcePath) const {
+    FARCICAL_PROFILE_SCOPE("SceneCache::Read");
+    const std::filesystem::path entryPath{GetEntryPath(sourcePath)};
+    const auto& readEntry{ReadWholeFile(entryPath)};
+    if(!readEntry.has_value()) {
+        const std::string failMsg{"No SceneCache entry for " + std::string{sourcePath} + "."};
+        return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
+    } // if there is no entry
+    const std::string& entry{readEntry.value()};
+
+    Header header;
+    if(entry.size() < sizeof(Header)) {
+        const std::string failMsg{"SceneCache entry for " + std::string{sourcePath} + " is truncated."};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if entry is too short to hold a Header
+    std::memcpy(&header, entry.data(), sizeof(Header));
+    if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version) {
+        const std::string failMsg{"SceneCache entry for " + std::string{sourcePath} + " is from another version."};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if magic or version do not match
+    if(entry.size() - sizeof(Header) < header.pathLength
+       || std::string_view{entry}.substr(sizeof(Header), header.pathLength) != sourcePath) {
+        const std::string failMsg{"SceneCache entry for " + std::string{sourcePath} + " belongs to another document."};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if entry was written for a different path
+
+    std::error_code sizeErrorCode;
+    std::error_code timeErrorCode;
+    const std::uintmax_t sourceSize{std::filesystem::file_size(sourcePath, sizeErrorCode)};
+    const std::int64_t sourceModifiedTime{GetModifiedTime(sourcePath, timeErrorCode)};
+    if(sizeErrorCode || timeErrorCode) {
+        const std::string failMsg{"Invalid path: Could not read " + std::string{sourcePath} + "."};
+        return std::unexpected(engine::Error{engine::Error::Signal::InvalidPath, failMsg});
+    } // if source could not be examined
+    if(header.sourceSize != sourceSize || header.sourceModifiedTime != sourceModifiedTime) {
+        // Touched, copied or checked out again; only stale if the contents really changed
+        const auto& readSource{ReadWholeFile(sourcePath)};
+        if(!readSource.has_value() || HashBytes(readSource.value()) != header.sourceHash) {
+            const std::string failMsg{"SceneCache entry for " + std::string{sourcePath} + " is stale."};
+            return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+        } // if contents changed
+        // Save the next start from hashing it again
+        header.sourceSize = readSource.value().size();
+        header.sourceModifiedTime = sourceModifiedTime;
+        std::fstream output{entryPath, std::ios_base::in | std::ios_base::out | std::ios_base::binary};
+        output.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    } // if size or modification time changed
+
+    const std::string_view encodedProperties{std::string_view{entry}.substr(sizeof(Header) + header.pathLength)};
+    if(HashBytes(encodedProperties) != header.propertiesHash) {
+        const std::string failMsg{"SceneCache entry for " + std::string{sourcePath} + " is corrupt."};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if entry was damaged
+    Reader reader{encodedProperties};
+    SceneProperties properties;
+    Get(reader, properties);
+    if(!reader.isValid || reader.offset != reader.data.size()) {
+        const std::string failMsg{"SceneCache entry for " + std::string{sourcePath} + " is corrupt."};
+        return std::unexpected(engine::Error{engine::Error::Signal::UnexpectedValue, failMsg});
+    } // if entry could not be decoded
+    return properties;
+}
+
+std::optional<farcical::engine::Error> farcical::ui::SceneCache::Write(std::string_view sourcePath,
+                                                                     const SceneProperties& properties) const {
+    FARCICAL_PROFILE_SCOPE("SceneCache::Write");
+    const auto& readSource{ReadWholeFile(sourcePath)};
+    std::error_code errorCode;
+    const std::int64_t sourceModifiedTime{GetModifiedTime(sourcePath, errorCode)};
+    if(!readSource.has_value() || errorCode) {
+        const std::string failMsg{"Invalid path: Could not read " + std::string{sourcePath} + "."};
+        return engine::Error{engine::Error::Signal::InvalidPath, failMsg};
+    } // if source could not be read
+
+    Writer writer;
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.pathLength = static_cast<std::uint32_t>(sourcePath.size());
+    header.sourceSize = readSource.value().size();
+    header.sourceModifiedTime = sourceModifiedTime;
+    header.sourceHash = HashBytes(readSource.value());
+    writer.buffer.append(reinterpret_cast<const char*>(&header), sizeof(Header));
+    writer.buffer.append(sourcePath);
+    Put(writer, properties);
+    if(!writer.isValid) {
+        const std::string failMsg{"SceneProperties from " + std::string{sourcePath} + " cannot be cached."};
+        return engine::Error{engine::Error::Signal::UnexpectedValue, failMsg};
+    } // if properties could not be encoded
+    const std::size_t propertiesOffset{sizeof(Header) + sourcePath.size()};
+    header.propertiesHash = HashBytes(std::string_view{writer.buffer}.substr(propertiesOffset));
+    std::memcpy(writer.buffer.data(), &header, sizeof(Header));
+
+    std::filesystem::create_directories(directory, errorCode);
+    // Written aside and renamed into place, so a reader never sees half an entry
+    const std::filesystem::path entryPath{GetEntryPath(sourcePath)};
+    std::filesystem::path tempPath{entryPath};
+    tempPath += ".tmp";
+    {
+        std::ofstream output{tempPath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc};
+        if(!output.is_open() || !output.write(writer.buffer.data(), static_cast<std::streamsize>(writer.buffer.size()))) {
+            const std::string failMsg{"Could not write SceneCache entry " + tempPath.string() + "."};
+            return engine::Error{engine::Error::Signal::WriteFailure, failMsg};
+        } // if entry could not be written
+    }
+    std::filesystem::rename(tempPath, entryPath, errorCode);
+    if(errorCode) {
+        std::filesystem::remove(tempPath, errorCode);
+        const std::string failMsg{"Could not write SceneCache entry " + entryPath.string() + "."};
+        return engine::Error{engine::Error::Signal::WriteFailure, failMsg};
+    } // if entry could not be moved into place
+    return std::nullopt;
+}
+
+bool farcical::ui::SceneCache::Contains(std::string_view sourcePath) const {
+    std::error_code errorCode;
+    return std::filesystem::exists(GetEntryPath(sourcePath), errorCode);
+}
+
+std::uint64_t farcical::ui::SceneCache::HashBytes(std::string_view bytes) {
+    return engine::HashBytes(bytes);
+}
+
+std::filesystem::path farcical::ui::SceneCache::GetEntryPath(std::string_view sourcePath) const {
+    return directory / std::format("{:016x}.scene", HashBytes(sourcePath));
+}
@@ -1,20 +1,27 @@
 //
 // Created by dgmuller on 8/17/25.
 //
+#include <filesystem>
+#include <ranges>
 #include "../../include/ui/sceneManager.hpp"
 #include "../../include/ui/factory.hpp"
+#include "../../include/ui/sceneReader.hpp"
 #include "../../include/engine/engine.hpp"
+#include "../../include/engine/profiler.hpp"
 #include "../../include/engine/system/render.hpp"
 #include "../../include/engine/system/music.hpp"
 
-farcical::ui::SceneManager::SceneManager(engine::Engine& engine) : LogInterface(engine.GetLogSystem()),
+farcical::ui::SceneManager::SceneManager(engine::Engine& engine) : LogInterface(engine.GetLogSystem(), "SceneManager"),
                                                                    engine{engine},
                                                                    resourceManager{engine.GetResourceManager()},
-                                                                   currentScene{nullptr} {
+                                                                   currentScene{nullptr},
+                                                                   sceneCache{engine.GetConfig().sceneCachePath},
+                                                                   cookedAssets{engine.GetConfig().cookedAssetPath} {
 }
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::LoadResourceIndex(std::string_view indexPath) {
-    WriteToLog("Loading SceneIndex from " + std::string{indexPath} + "...");
+    FARCICAL_PROFILE_SCOPE("SceneManager::LoadResourceIndex");
+    FARCICAL_LOG_DEBUG(*this, "Loading SceneIndex from {}...", indexPath);
     ResourceID indexID{sceneIndexDocumentID};
     const auto& createIndexHandle{
         resourceManager.CreateResourceHandle(indexID, ResourceHandle::Type::JSONDocument, indexPath)
@@ -66,21 +73,25 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::LoadResourceI
         const ResourceParameters resourceParameters{
             findResourceID.value().get<std::string>(), findResourcePath.value().get<std::string>()
         };
-        resourceIndex.insert(std::make_pair(sceneID, resourceParameters));
+        if(resourceIndex.insert(std::make_pair(sceneID, resourceParameters)).second) {
+            resourceIndexOrder.push_back(sceneID);
+        } // if sceneID was not already in index
     } // for each Scene in index
 
-    const auto& buildPropertiesCache{BuildPropertiesCache()};
-    if(buildPropertiesCache.has_value()) {
-        return buildPropertiesCache.value();
-    } // if buildPropertiesCache == failure
+    if(!engine.GetConfig().loadScenesOnDemand) {
+        const auto& buildPropertiesCache{BuildPropertiesCache()};
+        if(buildPropertiesCache.has_value()) {
+            return buildPropertiesCache.value();
+        } // if buildPropertiesCache == failure
+    } // if every Scene is loaded up front
 
-    WriteToLog("SceneIndex successfully loaded.");
+    LogInfo("SceneIndex successfully loaded.");
 
     return std::nullopt;
 }
 
 std::expected<farcical::ui::SceneProperties, farcical::engine::Error>
-farcical::ui::SceneManager::GetCurrentSceneProperties() const {
+farcical::ui::SceneManager::GetCurrentSceneProperties() {
     const auto& findSceneResult{FindSceneProperties(currentScene->GetID())};
     if(!findSceneResult.has_value()) {
         return std::unexpected(findSceneResult.error());
@@ -89,13 +100,18 @@ farcical::ui::SceneManager::GetCurrentSceneProperties() const {
 }
 
 std::expected<farcical::ui::SceneProperties, farcical::engine::Error> farcical::ui::SceneManager::FindSceneProperties(
-    engine::EntityID id) const {
+    engine::EntityID id) {
     const auto& findProperties{propertiesCache.find(id)};
-    if(findProperties == propertiesCache.end()) {
-        const std::string failMsg{"Error: Scene (id=\"" + id + "\") not found."};
-        return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
-    } // if findProperties == failure
-    return findProperties->second;
+    if(findProperties != propertiesCache.end()) {
+        CachedScene& cachedScene{findProperties->second};
+        propertiesLRU.splice(propertiesLRU.begin(), propertiesLRU, cachedScene.lruPosition);
+        return cachedScene.properties;
+    } // if SceneProperties are cached
+    const auto& loadProperties{LoadSceneProperties(id)};
+    if(!loadProperties.has_value()) {
+        return std::unexpected(loadProperties.error());
+    } // if loadProperties == failure
+    return CacheSceneProperties(id, loadProperties.value());
 }
 
 farcical::ui::Scene* farcical::ui::SceneManager::GetCurrentScene() const {
@@ -104,10 +120,12 @@ farcical::ui::Scene* farcical::ui::SceneManager::GetCurrentScene() const {
 
 std::expected<farcical::ui::Scene*, farcical::engine::Error> farcical::ui::SceneManager::SetCurrentScene(
     engine::EntityID id) {
+    FARCICAL_PROFILE_SCOPE("SceneManager::SetCurrentScene");
     /*
         STEP ZERO: Create the Scene and load its SceneProperties from cache
     */
-    WriteToLog("Creating Scene (id=\"" + id + "\")...");
+    FARCICAL_LOG_DEBUG(*this, "Creating Scene (id=\"{}\")...", id);
+    const sf::Clock createClock;
     currentScene = std::make_unique<Scene>(id);
 
     const auto& createEventCmp{
@@ -197,16 +215,32 @@ std::expected<farcical::ui::Scene*, farcical::engine::Error> farcical::ui::Scene
         } // if currentMusic does not match properties.music
     } // if Music
 
-    WriteToLog("Scene (id=\"" + id + "\") successfully created.");
+    if(engine.GetConfig().loadScenesOnDemand && engine.GetConfig().preloadLinkedScenes) {
+        const auto& preloadLinkedScenes{PreloadLinkedScenes(properties)};
+        if(preloadLinkedScenes.has_value()) {
+            // Only a head start; the Scene will be loaded again when it's created
+            LogWarning("{}", preloadLinkedScenes.value().message);
+        } // if preloadLinkedScenes == failure
+    } // if linked Scenes should be preloaded
+
+    LogInfo("Scene (id=\"{}\") successfully created in {}us.", id, createClock.getElapsedTime().asMicroseconds());
+    if(!engine.GetConfig().compositeCachePath.empty()) {
+        FARCICAL_LOG_DEBUG(*this, "CompositeCache so far: {} hits, {} misses, {} evicted.",
+                           resourceManager.GetCompositeCacheStatistics().numHits,
+                           resourceManager.GetCompositeCacheStatistics().numMisses,
+                           resourceManager.GetCompositeCacheStatistics().numEvictions);
+    } // if compositeCache is enabled
     return currentScene.get();
 }
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyCurrentScene() {
+    FARCICAL_PROFILE_SCOPE("SceneManager::DestroyCurrentScene");
     if(!currentScene) {
         return std::nullopt;
     } // if there is no currentScene
 
-    WriteToLog("Destroying Scene (id=\"" + currentScene->GetID() + "\")...");
+    FARCICAL_LOG_DEBUG(*this, "Destroying Scene (id=\"{}\")...", currentScene->GetID());
+    const sf::Clock destroyClock;
 
     const auto& destroyEventCmp{
         engine.GetEventSystem().DestroyEventComponent(currentScene->GetID())
@@ -304,47 +338,344 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyCurren
     } // if destroyCacheResult == failure
 
     currentScene.reset(nullptr);
-    WriteToLog("Scene (id=\"" + properties.id + "\") successfully destroyed.");
+    LogInfo("Scene (id=\"{}\") successfully destroyed in {}us.",
+            properties.id, destroyClock.getElapsedTime().asMicroseconds());
+
+    return std::nullopt;
+}
+
+std::optional<farcical::engine::Error> farcical::ui::SceneManager::RequestScene(engine::EntityID id) {
+    FARCICAL_PROFILE_SCOPE("SceneManager::RequestScene");
+    if(pendingSceneID == id) {
+        return std::nullopt;
+    } // if Scene was already requested
+    const auto& findProperties{FindSceneProperties(id)};
+    if(!findProperties.has_value()) {
+        return findProperties.error();
+    } // if findProperties == failure
+    const SceneProperties& properties{findProperties.value()};
+    if(pendingSceneID.has_value()) {
+        FARCICAL_LOG_DEBUG(*this, "Scene (id=\"{}\") requested before Scene (id=\"{}\") finished loading.", id,
+                           pendingSceneID.value());
+        const auto& releaseResources{ReleasePendingResources(properties)};
+        if(releaseResources.has_value()) {
+            return releaseResources.value();
+        } // if releaseResources == failure
+    } // if another Scene was pending
+
+    FARCICAL_LOG_DEBUG(*this, "Requesting Scene (id=\"{}\")...", id);
+    const auto& requestResources{RequestResources(properties)};
+    if(requestResources.has_value()) {
+        return requestResources.value();
+    } // if requestResources == failure
+    for(const auto& fontProperties: properties.fonts) {
+        pendingResources.insert_or_assign(fontProperties.id, fontProperties.persist);
+    } // for each Font
+    for(const auto& textureProperties: properties.textures) {
+        pendingResources.insert_or_assign(textureProperties.id, textureProperties.persist);
+    } // for each Texture
+    pendingSceneID = id;
+    return std::nullopt;
+}
 
+std::optional<farcical::engine::Error> farcical::ui::SceneManager::Update() {
+    if(!pendingSceneID.has_value()) {
+        return std::nullopt;
+    } // if no Scene is pending
+    for(const auto& resourceID: pendingResources | std::views::keys) {
+        const ResourceHandle* handle{resourceManager.GetResourceHandle(resourceID)};
+        if(handle && handle->status == ResourceHandle::Status::Loading) {
+            return std::nullopt;
+        } // if resource is still Loading
+    } // for each pending resource
+
+    // Anything that failed to load is reported by SetCurrentScene
+    FARCICAL_PROFILE_SCOPE("SceneManager::Update");
+    const engine::EntityID nextSceneID{pendingSceneID.value()};
+    const auto& destroyCurrentScene{DestroyCurrentScene()};
+    pendingSceneID.reset();
+    pendingResources.clear();
+    if(destroyCurrentScene.has_value()) {
+        return destroyCurrentScene.value();
+    } // if destroyCurrentScene == failure
+    const auto& createNextScene{SetCurrentScene(nextSceneID)};
+    if(!createNextScene.has_value()) {
+        return createNextScene.error();
+    } // if createNextScene == failure
     return std::nullopt;
 }
 
+bool farcical::ui::SceneManager::IsScenePending() const {
+    return pendingSceneID.has_value();
+}
+
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildPropertiesCache() {
-    for(const auto& sceneResource: resourceIndex) {
-        const engine::EntityID& sceneID{sceneResource.first};
-        const ResourceID& documentID{sceneResource.second.first};
-        const std::string& documentPath{engine.GetConfig().scenePath + "/" + sceneResource.second.second};
-        WriteToLog("Loading JSONDocument for Scene (id=\"" + sceneID + "\")...");
-        const auto& createDocumentHandle{
-            engine.GetResourceManager().CreateResourceHandle(
-                documentID,
-                ResourceHandle::Type::JSONDocument,
-                documentPath)
-        };
-        if(!createDocumentHandle.has_value()) {
-            return createDocumentHandle.error();
-        } // if createDocumentHandle == failure
-
-        const ResourceHandle& documentHandle{*createDocumentHandle.value()};
-        // Request the JSONDocument from the ResourceManager
-        const auto& requestJSONDoc{engine.GetResourceManager().GetJSONDoc(documentHandle.id)};
-        if(!requestJSONDoc.has_value()) {
-            return requestJSONDoc.error();
-        } // if requestJSONDoc == failure
-
-        const auto& sceneJSON{requestJSONDoc.value()};
-        const auto& loadSceneResult{LoadScene(*sceneJSON)};
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildPropertiesCache");
+    const sf::Clock buildClock;
+    std::vector<std::string> documentPaths;
+    documentPaths.reserve(resourceIndexOrder.size());
+    for(const auto& sceneID: resourceIndexOrder) {
+        documentPaths.push_back(engine.GetConfig().scenePath + "/" + resourceIndex.at(sceneID).second);
+    } // for each Scene in SceneIndex
+    engine::JobSystem& jobSystem{engine.GetJobSystem()};
+    std::vector<bool> isPacked;
+    isPacked.reserve(documentPaths.size());
+    for(const auto& documentPath: documentPaths) {
+        isPacked.push_back(resourceManager.FindPackedAsset(documentPath).has_value());
+    } // for each document
+
+    // Anything sceneCache has a fresh copy of needs no parsing at all; each job writes only its own slot
+    std::vector<std::expected<SceneProperties, engine::Error>> loadSceneResults(
+        documentPaths.size(), std::unexpected(engine::Error{engine::Error::Signal::None, ""}));
+    if(sceneCache.IsEnabled()) {
+        jobSystem.ParallelFor(documentPaths.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t index = begin; index < end; ++index) {
+                if(!isPacked[index]) {
+                    loadSceneResults[index] = sceneCache.Read(documentPaths[index]);
+                } // if document is loose
+            } // for each Scene in range
+        });
+    } // if sceneCache.IsEnabled()
+    std::vector<std::size_t> misses;
+    for(std::size_t index = 0; index < documentPaths.size(); ++index) {
+        if(!loadSceneResults[index].has_value()) {
+            misses.push_back(index);
+        } // if Scene was not cached
+    } // for each Scene in SceneIndex
+
+    // Each job streams its own document straight into SceneProperties, so no DOM is ever built
+    jobSystem.ParallelFor(misses.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t missIndex = begin; missIndex < end; ++missIndex) {
+            const std::size_t index{misses[missIndex]};
+            loadSceneResults[index] = ReadSceneDocument(documentPaths[index]);
+            if(loadSceneResults[index].has_value() && sceneCache.IsEnabled() && !isPacked[index]) {
+                // A Scene that can't be cached is simply parsed again next time
+                sceneCache.Write(documentPaths[index], loadSceneResults[index].value());
+            } // if Scene loaded
+        } // for each Scene in range
+    });
+
+    for(std::size_t index = 0; index < resourceIndexOrder.size(); ++index) {
+        auto& loadSceneResult{loadSceneResults[index]};
         if(!loadSceneResult.has_value()) {
             return loadSceneResult.error();
         } // if loadSceneResult == failure
-        propertiesCache.emplace(sceneID, loadSceneResult.value());
+        const engine::EntityID& sceneID{resourceIndexOrder[index]};
+        propertiesLRU.push_back(sceneID);
+        propertiesCache.insert_or_assign(sceneID, CachedScene{std::move(loadSceneResult.value()),
+                                                              std::prev(propertiesLRU.end())});
     } // for each Scene in SceneIndex
 
+    LogInfo("{} Scenes loaded ({} from SceneCache) in {}us.", resourceIndexOrder.size(),
+            resourceIndexOrder.size() - misses.size(), buildClock.getElapsedTime().asMicroseconds());
+    return std::nullopt;
+}
+
+std::expected<farcical::ui::SceneProperties, farcical::engine::Error>
+farcical::ui::SceneManager::LoadSceneProperties(engine::EntityID id) {
+    FARCICAL_PROFILE_SCOPE("SceneManager::LoadSceneProperties");
+    const auto& findResource{resourceIndex.find(id)};
+    if(findResource == resourceIndex.end()) {
+        const std::string failMsg{"Error: Scene (id=\"" + id + "\") not found."};
+        return std::unexpected(engine::Error{engine::Error::Signal::ResourceNotFound, failMsg});
+    } // if Scene is not in SceneIndex
+    const ResourceID& documentID{findResource->second.first};
+    const std::string documentPath{engine.GetConfig().scenePath + "/" + findResource->second.second};
+    const sf::Clock loadClock;
+    // Streaming from the AssetPack's mapping is as cheap as reading sceneCache, so packed documents aren't cached
+    const bool useSceneCache{sceneCache.IsEnabled() && !resourceManager.FindPackedAsset(documentPath).has_value()};
+    if(useSceneCache) {
+        const auto& readCache{sceneCache.Read(documentPath)};
+        if(readCache.has_value()) {
+            if(preloadedScenes.erase(id) > 0) {
+                resourceManager.DestroyResourceHandle(documentID, ResourceHandle::Type::JSONDocument);
+            } // if the document was preloaded anyway
+            FARCICAL_LOG_DEBUG(*this, "SceneProperties (id=\"{}\") read from SceneCache in {}us.", id,
+                               loadClock.getElapsedTime().asMicroseconds());
+            return readCache.value();
+        } // if readCache == success
+        FARCICAL_LOG_DEBUG(*this, "{}", readCache.error().message);
+    } // if useSceneCache
+
+    std::expected<SceneProperties, engine::Error> loadSceneResult{
+        std::unexpected(engine::Error{engine::Error::Signal::None, ""})
+    };
+    if(preloadedScenes.erase(id) > 0) {
+        // Picks up where PreloadLinkedScenes left off, since it got to this Scene first
+        FARCICAL_LOG_TRACE(*this, "Loading preloaded JSONDocument for Scene (id=\"{}\")...", id);
+        const auto& requestJSONDoc{resourceManager.GetJSONDoc(documentID)};
+        loadSceneResult = requestJSONDoc.has_value()
+                              ? LoadScene(*requestJSONDoc.value())
+                              : std::unexpected(requestJSONDoc.error());
+        // Once parsed, the document is only taking up space; a failed one is released too, so it can be tried again
+        resourceManager.DestroyResourceHandle(documentID, ResourceHandle::Type::JSONDocument);
+    } // if the document was preloaded
+    else {
+        FARCICAL_LOG_TRACE(*this, "Reading Scene (id=\"{}\") from {}...", id, documentPath);
+        loadSceneResult = ReadSceneDocument(documentPath);
+    } // else stream it from the AssetPack or disk
+    if(loadSceneResult.has_value()) {
+        FARCICAL_LOG_DEBUG(*this, "SceneProperties (id=\"{}\") loaded in {}us.", id,
+                           loadClock.getElapsedTime().asMicroseconds());
+        if(useSceneCache) {
+            const auto& writeCache{sceneCache.Write(documentPath, loadSceneResult.value())};
+            if(writeCache.has_value()) {
+                LogWarning("{}", writeCache.value().message);
+            } // if writeCache == failure
+        } // if useSceneCache
+    } // if loadSceneResult == success
+    return loadSceneResult;
+}
+
+std::expected<farcical::ui::SceneProperties, farcical::engine::Error>
+farcical::ui::SceneManager::ReadSceneDocument(const std::string& documentPath) const {
+    const auto& findPacked{resourceManager.FindPackedAsset(documentPath)};
+    if(findPacked.has_value()) {
+        return ReadScene(std::string_view{reinterpret_cast<const char*>(findPacked.value().data()),
+                                          findPacked.value().size()});
+    } // if document is packed
+    return ReadSceneFile(documentPath);
+}
+
+const farcical::ui::SceneProperties& farcical::ui::SceneManager::CacheSceneProperties(
+    engine::EntityID id, SceneProperties properties) {
+    propertiesLRU.push_front(id);
+    CachedScene& cachedScene{
+        propertiesCache.insert_or_assign(id, CachedScene{std::move(properties), propertiesLRU.begin()}).first->second
+    };
+    const std::size_t maxCachedScenes{engine.GetConfig().maxCachedScenes};
+    if(maxCachedScenes > 0) {
+        // Never evict the current Scene: DestroyCurrentScene needs its SceneProperties
+        auto lruIter{std::prev(propertiesLRU.end())};
+        while(propertiesCache.size() > maxCachedScenes && lruIter != propertiesLRU.begin()) {
+            const auto evictIter{lruIter--};
+            if(currentScene && *evictIter == currentScene->GetID()) {
+                continue;
+            } // if evictIter is the current Scene
+            FARCICAL_LOG_DEBUG(*this, "Evicting SceneProperties (id=\"{}\").", *evictIter);
+            propertiesCache.erase(*evictIter);
+            propertiesLRU.erase(evictIter);
+        } // while there are too many SceneProperties
+    } // if propertiesCache is capped
+    return cachedScene.properties;
+}
+
+std::optional<farcical::engine::Error> farcical::ui::SceneManager::PreloadLinkedScenes(
+    const SceneProperties& properties) {
+    FARCICAL_PROFILE_SCOPE("SceneManager::PreloadLinkedScenes");
+    // Every Scene a button on this one can create, directly or from a submenu
+    std::unordered_set<engine::EntityID> linkedScenes;
+    std::vector<const MenuProperties*> menus;
+    for(const auto& layer: properties.layout.layers) {
+        menus.push_back(&layer.menuProperties);
+    } // for each layer
+    while(!menus.empty()) {
+        const MenuProperties& menu{*menus.back()};
+        menus.pop_back();
+        for(const auto& buttonProperties: menu.buttonProperties) {
+            const engine::Event::Parameters& onPressEvent{buttonProperties.onPressEvent};
+            if(onPressEvent.type != engine::Event::Type::CreateScene || onPressEvent.args.empty()) {
+                continue;
+            } // if button does not create a Scene
+            const std::string* sceneName{std::any_cast<std::string>(&onPressEvent.args.at(0))};
+            // A name that was never interned isn't in the SceneIndex; GameController reports it if pressed
+            const auto& findSceneID{sceneName ? engine::EntityID::Find(*sceneName) : std::nullopt};
+            if(findSceneID.has_value() && !propertiesCache.contains(findSceneID.value())) {
+                linkedScenes.insert(findSceneID.value());
+            } // if linked Scene is not already loaded
+        } // for each button
+        for(const auto& submenu: menu.menuProperties) {
+            menus.push_back(&submenu);
+        } // for each submenu
+    } // while there are menus left to search
+
+    // Release whatever the previous Scene preloaded that this one can't reach
+    for(auto preloadIter = preloadedScenes.begin(); preloadIter != preloadedScenes.end();) {
+        if(linkedScenes.contains(*preloadIter)) {
+            ++preloadIter;
+            continue;
+        } // if Scene is still linked
+        resourceManager.DestroyResourceHandle(resourceIndex.at(*preloadIter).first,
+                                              ResourceHandle::Type::JSONDocument);
+        preloadIter = preloadedScenes.erase(preloadIter);
+    } // for each preloaded Scene
+
+    for(const auto& sceneID: linkedScenes) {
+        const auto& findResource{resourceIndex.find(sceneID)};
+        if(findResource == resourceIndex.end() || preloadedScenes.contains(sceneID)) {
+            continue;
+        } // if Scene is unknown (SetCurrentScene will report it) or already preloaded
+        const std::string documentPath{engine.GetConfig().scenePath + "/" + findResource->second.second};
+        if(sceneCache.Contains(documentPath) || resourceManager.FindPackedAsset(documentPath).has_value()) {
+            continue;
+        } // if it will most likely come from sceneCache, or can be streamed straight from the AssetPack
+        FARCICAL_LOG_TRACE(*this, "Preloading JSONDocument for Scene (id=\"{}\")...", sceneID);
+        const auto& requestDocument{resourceManager.RequestJSONAsync(findResource->second.first, documentPath)};
+        if(!requestDocument.has_value()) {
+            return requestDocument.error();
+        } // if requestDocument == failure
+        preloadedScenes.insert(sceneID);
+    } // for each linked Scene
+    return std::nullopt;
+}
+
+std::optional<farcical::engine::Error> farcical::ui::SceneManager::RequestResources(
+    const SceneProperties& properties) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::RequestResources");
+    for(const auto& fontProperties: properties.fonts) {
+        const auto& requestFont{resourceManager.RequestFontAsync(fontProperties)};
+        if(!requestFont.has_value()) {
+            return requestFont.error();
+        } // if requestFont == failure
+    } // for each Font
+    for(const auto& textureProperties: properties.textures) {
+        const auto& requestTexture{resourceManager.RequestTextureAsync(textureProperties)};
+        if(!requestTexture.has_value()) {
+            return requestTexture.error();
+        } // if requestTexture == failure
+    } // for each Texture
+    return std::nullopt;
+}
+
+std::optional<farcical::engine::Error> farcical::ui::SceneManager::ReleasePendingResources(
+    const SceneProperties& nextProperties) {
+    std::unordered_set<ResourceID> nextResources;
+    for(const auto& fontProperties: nextProperties.fonts) {
+        nextResources.insert(fontProperties.id);
+    } // for each Font
+    for(const auto& textureProperties: nextProperties.textures) {
+        nextResources.insert(textureProperties.id);
+    } // for each Texture
+    for(const auto& [resourceID, persist]: pendingResources) {
+        if(persist || nextResources.contains(resourceID)) {
+            continue;
+        } // if resource is kept anyway, or still needed
+        if(currentScene && (currentScene->GetCachedFont(resourceID) || currentScene->GetCachedTexture(resourceID))) {
+            continue;
+        } // if the current Scene uses it
+        const ResourceHandle* handle{resourceManager.GetResourceHandle(resourceID)};
+        if(!handle) {
+            continue;
+        } // if handle was already destroyed
+        // Destroying a handle that is still Loading is safe; ResourceManager drops the decoded result
+        const auto& destroyHandle{resourceManager.DestroyResourceHandle(resourceID, handle->type)};
+        if(destroyHandle.has_value()) {
+            return destroyHandle.value();
+        } // if destroyHandle == failure
+    } // for each pending resource
+    pendingSceneID.reset();
+    pendingResources.clear();
     return std::nullopt;
 }
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildResourceCache(
     const SceneProperties& properties) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildResourceCache");
+    const auto& requestResources{RequestResources(properties)};
+    if(requestResources.has_value()) {
+        return requestResources.value();
+    } // if requestResources == failure
+
     /* MUSIC */
     if(!properties.music.id.empty()) {
         const auto& buildMusicCache{
@@ -389,7 +720,7 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildResource
 
     /* OVERLAY TEXTURES */
     const auto& buildOverlayTextureCache{
-        BuildOverlayTextureCache(properties.overlayTextures)
+        BuildOverlayTextureCache(properties.overlayTextures, properties)
     };
     if(buildOverlayTextureCache.has_value()) {
         return buildOverlayTextureCache.value();
@@ -408,6 +739,7 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildResource
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyResourceCache(
     const SceneProperties& properties) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::DestroyResourceCache");
     /* MUSICS */
     currentScene->ClearMusicCache();
     currentScene->ClearMusicPropertiesCache();
@@ -427,6 +759,7 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyResour
     /* TEXTURES */
     currentScene->ClearTextureCache();
     currentScene->ClearTexturePropertiesCache();
+    currentScene->ClearNineSliceCache();
     const auto& destroyTextureCache{DestroyTextureCache(properties.textures)};
     if(destroyTextureCache.has_value()) {
         return destroyTextureCache.value();
@@ -461,6 +794,7 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyResour
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildMusicCache(
     const std::vector<MusicProperties>& musics) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildMusicCache");
     for(const auto& musicProperties: musics) {
         ResourceHandle* handle{resourceManager.GetResourceHandle(musicProperties.id)};
         if(handle) {
@@ -509,13 +843,16 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyMusicC
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildFontCache(
     const std::vector<FontProperties>& fonts) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildFontCache");
     for(const auto& fontProperties: fonts) {
-        const auto& createHandle{
-            resourceManager.CreateResourceHandle(fontProperties.id, ResourceHandle::Type::Font, fontProperties.path)
-        };
-        if(!createHandle.has_value()) {
-            return createHandle.error();
-        } // if createHandle == failure
+        if(!resourceManager.GetResourceHandle(fontProperties.id)) {
+            const auto& createHandle{
+                resourceManager.CreateResourceHandle(fontProperties.id, ResourceHandle::Type::Font, fontProperties.path)
+            };
+            if(!createHandle.has_value()) {
+                return createHandle.error();
+            } // if createHandle == failure
+        } // if handle was not created by RequestResources
         const auto& loadFont{resourceManager.GetFont(fontProperties.id)};
         if(!loadFont.has_value()) {
             return loadFont.error();
@@ -529,9 +866,9 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildFontCach
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyFontCache(
     const std::vector<FontProperties>& fonts) const {
     for(const auto& fontProperties: fonts) {
-        if(fontProperties.persist) {
+        if(fontProperties.persist || pendingResources.contains(fontProperties.id)) {
             continue;
-        } // skip any Font with (persist flag == true)
+        } // skip any Font with (persist flag == true), or that the pending Scene will use
         const auto& destroyHandle{
             resourceManager.DestroyResourceHandle(fontProperties.id, ResourceHandle::Type::Font)
         };
@@ -544,14 +881,17 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyFontCa
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildTextureCache(
     const std::vector<TextureProperties>& textures) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildTextureCache");
     for(const auto& textureProperties: textures) {
-        const auto& createHandle{
-            resourceManager.CreateResourceHandle(textureProperties.id, ResourceHandle::Type::Texture,
-                                                 textureProperties.path)
-        };
-        if(!createHandle.has_value()) {
-            return createHandle.error();
-        } // if createHandle == failure
+        if(!resourceManager.GetResourceHandle(textureProperties.id)) {
+            const auto& createHandle{
+                resourceManager.CreateResourceHandle(textureProperties.id, ResourceHandle::Type::Texture,
+                                                     textureProperties.path)
+            };
+            if(!createHandle.has_value()) {
+                return createHandle.error();
+            } // if createHandle == failure
+        } // if handle was not created by RequestResources
         const auto& loadTexture{resourceManager.GetTexture(textureProperties)};
         if(!loadTexture.has_value()) {
             return loadTexture.error();
@@ -565,9 +905,9 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildTextureC
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyTextureCache(
     const std::vector<TextureProperties>& textures) const {
     for(const auto& textureProperties: textures) {
-        if(textureProperties.persist) {
+        if(textureProperties.persist || pendingResources.contains(textureProperties.id)) {
             continue;
-        } // skip any Texture with (persist flag == true)
+        } // skip any Texture with (persist flag == true), or that the pending Scene will use
         const auto& destroyHandle{
             resourceManager.DestroyResourceHandle(textureProperties.id, ResourceHandle::Type::Texture)
         };
@@ -580,28 +920,38 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyTextur
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildRepeatingTextureCache(
     const std::vector<RepeatingTextureProperties>& textures) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildRepeatingTextureCache");
     for(const auto& textureProperties: textures) {
-        const auto& createInputHandle{
-            resourceManager.CreateResourceHandle(textureProperties.inputID, ResourceHandle::Type::Texture,
-                                                 textureProperties.path)
+        sf::Texture* texture{
+            cookedAssets.IsEnabled()
+                ? LoadCookedTexture(textureProperties.outputID,
+                                    cookedAssets.GetTexturePath(resourceManager, textureProperties))
+                : nullptr
         };
-        if(!createInputHandle.has_value()) {
-            return createInputHandle.error();
-        } // if createInputHandle == failure
+        if(!texture) {
+            const auto& createInputHandle{
+                resourceManager.CreateResourceHandle(textureProperties.inputID, ResourceHandle::Type::Texture,
+                                                     textureProperties.path)
+            };
+            if(!createInputHandle.has_value()) {
+                return createInputHandle.error();
+            } // if createInputHandle == failure
 
-        const auto& createOutputHandle{
-            resourceManager.CreateResourceHandle(textureProperties.outputID, ResourceHandle::Type::Texture,
-                                                 textureProperties.path)
-        };
-        if(!createOutputHandle.has_value()) {
-            return createOutputHandle.error();
-        } // if createOutputHandle == failure
+            const auto& createOutputHandle{
+                resourceManager.CreateResourceHandle(textureProperties.outputID, ResourceHandle::Type::Texture,
+                                                     textureProperties.path)
+            };
+            if(!createOutputHandle.has_value()) {
+                return createOutputHandle.error();
+            } // if createOutputHandle == failure
 
-        const auto& loadTexture(resourceManager.GetTexture(textureProperties));
-        if(!loadTexture.has_value()) {
-            return loadTexture.error();
-        } // if loadTexture == failure
-        currentScene->CacheTexture(textureProperties.outputID, loadTexture.value());
+            const auto& loadTexture(resourceManager.GetTexture(textureProperties));
+            if(!loadTexture.has_value()) {
+                return loadTexture.error();
+            } // if loadTexture == failure
+            texture = loadTexture.value();
+        } // if texture was not cooked
+        currentScene->CacheTexture(textureProperties.outputID, texture);
         currentScene->CacheTextureProperties(
             textureProperties.outputID, TextureProperties{
                 textureProperties.outputID,
@@ -637,47 +987,55 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyRepeat
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildSegmentedTextureCache(
     const std::vector<SegmentedTextureProperties>& textures) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildSegmentedTextureCache");
     for(const auto& textureProperties: textures) {
-        const ResourceID textureID{textureProperties.id + "Texture"};
-        const auto& createHandle{
-            resourceManager.CreateResourceHandle(
-                textureID, ResourceHandle::Type::Texture, textureProperties.path)
+        const ResourceID splicedTextureID{textureProperties.id + "Texture"};
+        sf::Texture* texture{
+            cookedAssets.IsEnabled()
+                ? LoadCookedTexture(splicedTextureID, cookedAssets.GetTexturePath(resourceManager, textureProperties))
+                : nullptr
         };
-        if(!createHandle.has_value()) {
-            return createHandle.error();
-        } // if createHandle == failure
-
-        std::vector<ResourceID> segmentIDList;
-        for(auto segmentProperties: textureProperties.segments) {
-            ResourceID segmentID{textureProperties.id};
-            segmentID += static_cast<char>(std::toupper(segmentProperties.id[0]));
-            segmentID.append(segmentProperties.id.substr(1, segmentProperties.id.length() - 1));
-            segmentID.append("Texture");
-            segmentProperties.id = segmentID;
-            const auto& createSegmentHandle{
+        if(!texture) {
+            const auto& createHandle{
                 resourceManager.CreateResourceHandle(
-                    segmentProperties.id, ResourceHandle::Type::Texture, segmentProperties.path)
+                    splicedTextureID, ResourceHandle::Type::Texture, textureProperties.path)
             };
-            if(!createSegmentHandle.has_value()) {
-                return createSegmentHandle.error();
-            } // if createSegmentHandle == failure
-
-            const auto& loadTexture{resourceManager.GetTexture(segmentProperties)};
-            if(!loadTexture.has_value()) {
-                return loadTexture.error();
-            } // if loadTexture == failure
-            segmentIDList.emplace_back(segmentProperties.id);
-        } // for each segment of SegmentedTexture
+            if(!createHandle.has_value()) {
+                return createHandle.error();
+            } // if createHandle == failure
 
-        const ResourceID splicedTextureID{textureProperties.id + "Texture"};
-        const auto& createTexture{
-            resourceManager.CreateSplicedTexture(splicedTextureID, segmentIDList)
-        };
-        if(!createTexture.has_value()) {
-            return createTexture.error();
-        } // if createTexture == failure
+            std::vector<ResourceID> segmentIDList;
+            for(auto segmentProperties: textureProperties.segments) {
+                ResourceID segmentID{textureProperties.id};
+                segmentID += static_cast<char>(std::toupper(segmentProperties.id[0]));
+                segmentID.append(segmentProperties.id.substr(1, segmentProperties.id.length() - 1));
+                segmentID.append("Texture");
+                segmentProperties.id = segmentID;
+                const auto& createSegmentHandle{
+                    resourceManager.CreateResourceHandle(
+                        segmentProperties.id, ResourceHandle::Type::Texture, segmentProperties.path)
+                };
+                if(!createSegmentHandle.has_value()) {
+                    return createSegmentHandle.error();
+                } // if createSegmentHandle == failure
+
+                const auto& loadTexture{resourceManager.GetTexture(segmentProperties)};
+                if(!loadTexture.has_value()) {
+                    return loadTexture.error();
+                } // if loadTexture == failure
+                segmentIDList.emplace_back(segmentProperties.id);
+            } // for each segment of SegmentedTexture
+
+            const auto& createTexture{
+                resourceManager.CreateSplicedTexture(splicedTextureID, segmentIDList)
+            };
+            if(!createTexture.has_value()) {
+                return createTexture.error();
+            } // if createTexture == failure
+            texture = createTexture.value();
+        } // if texture was not cooked
 
-        currentScene->CacheTexture(splicedTextureID, createTexture.value());
+        currentScene->CacheTexture(splicedTextureID, texture);
         currentScene->CacheTextureProperties(
             splicedTextureID, TextureProperties{
                 splicedTextureID,
@@ -720,20 +1078,30 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroySegmen
 }
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildOverlayTextureCache(
-    const std::vector<OverlayTextureProperties>& textures) const {
+    const std::vector<OverlayTextureProperties>& textures, const SceneProperties& sceneProperties) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildOverlayTextureCache");
     for(const auto& textureProperties: textures) {
-        const auto& createOverlayTexture{
-            resourceManager.CreateOverlayTexture(
-                textureProperties.id,
-                textureProperties.baseTextureID,
-                textureProperties.overlayTextureID,
-                textureProperties.opacity)
-        };
-        if(!createOverlayTexture.has_value()) {
-            return createOverlayTexture.error();
-        } // if createOverlayTexture == failure
         const ResourceID textureID{textureProperties.id + "Texture"};
-        currentScene->CacheTexture(textureID, createOverlayTexture.value());
+        sf::Texture* texture{
+            cookedAssets.IsEnabled()
+                ? LoadCookedTexture(textureID,
+                                    cookedAssets.GetTexturePath(resourceManager, textureProperties, sceneProperties))
+                : nullptr
+        };
+        if(!texture) {
+            const auto& createOverlayTexture{
+                resourceManager.CreateOverlayTexture(
+                    textureProperties.id,
+                    textureProperties.baseTextureID,
+                    textureProperties.overlayTextureID,
+                    textureProperties.opacity)
+            };
+            if(!createOverlayTexture.has_value()) {
+                return createOverlayTexture.error();
+            } // if createOverlayTexture == failure
+            texture = createOverlayTexture.value();
+        } // if texture was not cooked
+        currentScene->CacheTexture(textureID, texture);
         currentScene->CacheTextureProperties(textureID,
                                              TextureProperties{
                                                  textureID,
@@ -779,17 +1147,32 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyOverla
 
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildBorderTextureCache(
     const BorderTextureProperties& properties) const {
+    FARCICAL_PROFILE_SCOPE("SceneManager::BuildBorderTextureCache");
     if(properties.id.empty()) {
         return std::nullopt;
     } // if no borderTexture specified
 
-    const auto& createHandle{
-        resourceManager.CreateResourceHandle(properties.id, ResourceHandle::Type::Texture, properties.path)
+    const sf::Vector2u outputSize{GetBorderTextureSize(properties, engine.GetRenderSystem().GetWindow().getSize())};
+    // A NineSlice is drawn from its slices at whatever size it is, so there is nothing cooked to look for
+    sf::Texture* cookedTexture{
+        cookedAssets.IsEnabled() && !properties.isNineSlice
+            ? LoadCookedTexture(properties.id, cookedAssets.GetTexturePath(resourceManager, properties, outputSize))
+            : nullptr
     };
-    if(!createHandle.has_value()) {
-        return createHandle.error();
-    } // if createHandle == failure
+    if(cookedTexture) {
+        // Its corners, edges & center are already drawn into it, so none of them need loading
+        currentScene->CacheTexture(properties.id, cookedTexture);
+        currentScene->CacheTextureProperties(
+            properties.id, TextureProperties{
+                properties.id,
+                properties.path,
+                properties.scale,
+                sf::IntRect{{0, 0}, {0, 0}}
+            });
+        return std::nullopt;
+    } // if texture was cooked
 
+    engine::NineSlice nineSlice{{}, {}, nullptr, sf::Vector2f{outputSize}};
     std::vector<ResourceID> cornerTextureIDs;
     for(const auto& corner: properties.cornerTextures) {
         const auto& createCornerHandle{
@@ -806,6 +1189,7 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildBorderTe
         } // if loadCornerTexture == failure
         currentScene->CacheTexture(corner.id, loadCornerTexture.value());
         currentScene->CacheTextureProperties(corner.id, corner);
+        nineSlice.corners[cornerTextureIDs.size()] = loadCornerTexture.value();
         cornerTextureIDs.emplace_back(corner.id);
     } // for each corner
 
@@ -825,6 +1209,7 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildBorderTe
         } // if loadEdgeTexture == failure
         currentScene->CacheTexture(edge.id, loadEdgeTexture.value());
         currentScene->CacheTextureProperties(edge.id, edge);
+        nineSlice.edges[edgeTextureIDs.size()] = loadEdgeTexture.value();
         edgeTextureIDs.emplace_back(edge.id);
     } // for each edge
 
@@ -845,14 +1230,27 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildBorderTe
     } // if loadCenterTexture == failure
     currentScene->CacheTexture(properties.centerTexture.id, loadCenterTexture.value());
     currentScene->CacheTextureProperties(properties.centerTexture.id, properties.centerTexture);
+    nineSlice.center = loadCenterTexture.value();
 
-    const auto& windowSize{engine.GetRenderSystem().GetWindow().getSize()};
-    const sf::Vector2u outputSize{
-        static_cast<unsigned int>(
-            static_cast<float>(properties.percentSize.x) * static_cast<float>(windowSize.x) / 100.0 / properties.scale),
-        static_cast<unsigned int>(
-            static_cast<float>(properties.percentSize.y) * static_cast<float>(windowSize.y) / 100.0 / properties.scale)
+    const TextureProperties borderTextureProperties{
+        properties.id,
+        properties.path,
+        properties.scale,
+        sf::IntRect{{0, 0}, {0, 0}}
     };
+    if(properties.isNineSlice) {
+        currentScene->CacheNineSlice(properties.id, nineSlice);
+        currentScene->CacheTextureProperties(properties.id, borderTextureProperties);
+        return std::nullopt;
+    } // if Border is drawn from its slices
+
+    const auto& createHandle{
+        resourceManager.CreateResourceHandle(properties.id, ResourceHandle::Type::Texture, properties.path)
+    };
+    if(!createHandle.has_value()) {
+        return createHandle.error();
+    } // if createHandle == failure
+
     const auto& createBorderTexture{
         resourceManager.CreateBorderTexture(
             properties.id,
@@ -866,17 +1264,32 @@ std::optional<farcical::engine::Error> farcical::ui::SceneManager::BuildBorderTe
     } // if createBorderTexture == failure
 
     currentScene->CacheTexture(properties.id, createBorderTexture.value());
-    currentScene->CacheTextureProperties(
-        properties.id, TextureProperties{
-            properties.id,
-            properties.path,
-            properties.scale,
-            sf::IntRect{{0, 0}, {0, 0}}
-        });
+    currentScene->CacheTextureProperties(properties.id, borderTextureProperties);
 
     return std::nullopt;
 }
 
+sf::Texture* farcical::ui::SceneManager::LoadCookedTexture(const ResourceID& id, const std::string& cookedPath) const {
+    std::error_code errorCode;
+    if(!std::filesystem::exists(cookedPath, errorCode) && !resourceManager.FindPackedAsset(cookedPath).has_value()) {
+        FARCICAL_LOG_TRACE(*this, "No cooked Texture (id=\"{}\") at {}.", id, cookedPath);
+        return nullptr;
+    } // if it wasn't cooked, or not with these properties
+    const auto& createHandle{resourceManager.CreateResourceHandle(id, ResourceHandle::Type::Texture, cookedPath)};
+    if(!createHandle.has_value()) {
+        return nullptr;
+    } // if createHandle == failure
+    const auto& loadTexture{
+        resourceManager.GetTexture(TextureProperties{id, cookedPath, 1.0f, sf::IntRect{{0, 0}, {0, 0}}})
+    };
+    if(!loadTexture.has_value()) {
+        LogWarning("{}", loadTexture.error().message);
+        resourceManager.DestroyResourceHandle(id, ResourceHandle::Type::Texture);
+        return nullptr;
+    } // if loadTexture == failure
+    return loadTexture.value();
+}
+
 std::optional<farcical::engine::Error> farcical::ui::SceneManager::DestroyBorderTextureCache(
     const BorderTextureProperties& properties) const {
     if(properties.persist) {
@@ -0,0 +1,746 @@
+//
+// Created by dgmuller on 9/14/25.
+//
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../include/ui/sceneReader.hpp"
+#include "../../include/engine/mappedFile.hpp"
+#include "../../include/engine/profiler.hpp"
+
+namespace {
+    using farcical::engine::EntityID;
+    using farcical::engine::Error;
+    using farcical::ui::ButtonProperties;
+    using farcical::ui::LayoutLayerProperties;
+    using farcical::ui::Menu;
+    using farcical::ui::MenuProperties;
+    using farcical::ui::SceneProperties;
+    using farcical::ui::WidgetProperties;
+
+    // Assembles one JSON value out of SAX events
+    class FragmentBuilder {
+    public:
+        [[nodiscard]] bool IsBuilding() const {
+            return isBuilding;
+        }
+
+        // Complete once the value that started it has been closed (or was a scalar to begin with)
+        [[nodiscard]] bool IsComplete() const {
+            return isBuilding && openContainers.empty();
+        }
+
+        void SetKey(std::string key) {
+            nextKey = std::move(key);
+        }
+
+        void AddValue(nlohmann::json value) {
+            Insert(std::move(value));
+        }
+
+        void Open(nlohmann::json container) {
+            openContainers.push_back(Insert(std::move(container)));
+        }
+
+        void Close() {
+            openContainers.pop_back();
+        }
+
+        nlohmann::json Take() {
+            isBuilding = false;
+            return std::move(root);
+        }
+
+    private:
+        // Values only ever go into the innermost open container, so pointers to the outer ones stay valid
+        nlohmann::json* Insert(nlohmann::json value) {
+            if(!isBuilding) {
+                isBuilding = true;
+                root = std::move(value);
+                return &root;
+            } // if value is the fragment itself
+            nlohmann::json& parent{*openContainers.back()};
+            if(parent.is_array()) {
+                parent.push_back(std::move(value));
+                return &parent.back();
+            } // if parent is an array
+            nlohmann::json& member{parent[nextKey]};
+            member = std::move(value);
+            return &member;
+        }
+
+        nlohmann::json root;
+        std::vector<nlohmann::json*> openContainers;
+        std::string nextKey;
+        bool isBuilding{false};
+    };
+
+    // Walks the Scene, its layout, layers & menus as SAX events go by, and builds everything inside them (each
+    // texture, Decoration, Button...) as a FragmentBuilder fragment to hand to the matching Load* function
+    class SceneReader final : public nlohmann::json::json_sax_t {
+    public:
+        bool null() override {
+            return AddValue(nlohmann::json(nullptr));
+        }
+
+        bool boolean(bool value) override {
+            return AddValue(nlohmann::json(value));
+        }
+
+        bool number_integer(number_integer_t value) override {
+            return AddValue(nlohmann::json(value));
+        }
+
+        bool number_unsigned(number_unsigned_t value) override {
+            return AddValue(nlohmann::json(value));
+        }
+
+        bool number_float(number_float_t value, const string_t&) override {
+            return AddValue(nlohmann::json(value));
+        }
+
+        bool string(string_t& value) override {
+            return AddValue(nlohmann::json(std::move(value)));
+        }
+
+        bool binary(binary_t& value) override {
+            return AddValue(nlohmann::json::binary(std::move(value)));
+        }
+
+        bool start_object(std::size_t) override {
+            return OpenContainer(nlohmann::json::object());
+        }
+
+        bool key(string_t& key) override {
+            if(fragment.IsBuilding()) {
+                fragment.SetKey(std::move(key));
+            } // if building a fragment
+            else if(skipDepth == 0) {
+                frames.back().key = std::move(key);
+            } // else if not skipping
+            return true;
+        }
+
+        bool end_object() override {
+            return CloseContainer();
+        }
+
+        bool start_array(std::size_t) override {
+            return OpenContainer(nlohmann::json::array());
+        }
+
+        bool end_array() override {
+            return CloseContainer();
+        }
+
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& exception) override {
+            const std::string failMsg{
+                "Invalid configuration: Scene document could not be parsed: " + std::string{exception.what()}
+            };
+            error = Error{Error::Signal::InvalidConfiguration, failMsg};
+            return false;
+        }
+
+        std::expected<SceneProperties, Error> TakeResult() {
+            if(error.has_value()) {
+                return std::unexpected(error.value());
+            } // if reading failed
+            if(!isComplete) {
+                const std::string failMsg{"Invalid configuration: Scene document ended unexpectedly."};
+                return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+            } // if the document was cut short
+            return std::move(properties);
+        }
+
+    private:
+        // What the innermost container being walked (rather than built) holds
+        enum class Context {
+            Document,
+            Scene,
+            SceneList,
+            Layout,
+            Layer,
+            LayerList,
+            Menu,
+            MenuList
+        };
+
+        struct Frame {
+            Context context;
+            // The current key in an object; the name of the list for SceneList, LayerList & MenuList
+            std::string key;
+        };
+
+        // What happens to the value starting in the current Frame
+        enum class Action {
+            Build,
+            Skip,
+            Walk
+        };
+
+        // Everything LoadMenu would read besides the lists goes into header; each list is kept (along with the first
+        // error in it) until the Menu's type says which one counts
+        struct MenuState {
+            nlohmann::json header = nlohmann::json::object();
+            EntityID parentID;
+            bool foundButtons{false};
+            bool foundRadioButtons{false};
+            std::vector<ButtonProperties> buttons;
+            std::vector<WidgetProperties> radioButtons;
+            std::vector<MenuProperties> menus;
+            std::optional<Error> buttonsError;
+            std::optional<Error> radioButtonsError;
+            std::optional<Error> menusError;
+        };
+
+        struct LayerState {
+            LayoutLayerProperties properties;
+            bool foundID{false};
+        };
+
+        static bool IsSceneList(std::string_view key) {
+            return key == "fonts" || key == "textures" || key == "repeatingTextures" || key == "segmentedTextures"
+                   || key == "overlayTextures";
+        }
+
+        static bool IsMenuHeaderKey(std::string_view key) {
+            return key == "id" || key == "type" || key == "font" || key == "orientation" || key == "relativeSpacing"
+                   || key == "relativePosition" || key == "buttonTextures" || key == "radioButtonTextures";
+        }
+
+        // Only values shaped the way LoadScene expects are walked; anything else is built and handed to the DOM
+        // loaders, which report it exactly as LoadScene would
+        std::pair<Action, Context> Route(bool isObject, bool isContainer) const {
+            const Frame& frame{frames.back()};
+            switch(frame.context) {
+                case Context::Document: {
+                    return isObject ? std::pair{Action::Walk, Context::Scene} : std::pair{Action::Build, frame.context};
+                }
+                case Context::Scene: {
+                    if(isContainer && frame.key == "layout") {
+                        return {Action::Walk, Context::Layout};
+                    } // if layout
+                    if(isContainer && IsSceneList(frame.key)) {
+                        return {Action::Walk, Context::SceneList};
+                    } // if a list of resources
+                    if(frame.key == "id" || frame.key == "music" || frame.key == "borderTexture"
+                       || frame.key == "layout" || IsSceneList(frame.key)) {
+                        return {Action::Build, frame.context};
+                    } // if something else LoadScene reads
+                    return {Action::Skip, frame.context};
+                }
+                case Context::Layout: {
+                    return isObject ? std::pair{Action::Walk, Context::Layer} : std::pair{Action::Build, frame.context};
+                }
+                case Context::Layer: {
+                    if(isContainer && (frame.key == "decorations" || frame.key == "headings")) {
+                        return {Action::Walk, Context::LayerList};
+                    } // if a list of widgets
+                    if(isObject && frame.key == "menu") {
+                        return {Action::Walk, Context::Menu};
+                    } // if menu
+                    if(frame.key == "id" || frame.key == "title" || frame.key == "decorations"
+                       || frame.key == "headings" || frame.key == "menu") {
+                        return {Action::Build, frame.context};
+                    } // if something else LoadLayoutLayer reads
+                    return {Action::Skip, frame.context};
+                }
+                case Context::Menu: {
+                    if(isContainer && (frame.key == "buttons" || frame.key == "radioButtons" || frame.key == "menus")) {
+                        return {Action::Walk, Context::MenuList};
+                    } // if a list of widgets
+                    if(IsMenuHeaderKey(frame.key) || frame.key == "buttons" || frame.key == "radioButtons"
+                       || frame.key == "menus") {
+                        return {Action::Build, frame.context};
+                    } // if something else LoadMenu reads
+                    return {Action::Skip, frame.context};
+                }
+                case Context::MenuList: {
+                    if(isObject && frame.key == "menus") {
+                        return {Action::Walk, Context::Menu};
+                    } // if a submenu
+                    return {Action::Build, frame.context};
+                }
+                default: {
+                    return {Action::Build, frame.context};
+                }
+            } // switch context
+        }
+
+        bool AddValue(nlohmann::json value) {
+            if(fragment.IsBuilding()) {
+                fragment.AddValue(std::move(value));
+                return fragment.IsComplete() ? Deliver(fragment.Take()) : true;
+            } // if building a fragment
+            if(skipDepth > 0) {
+                return true;
+            } // if skipping
+            if(Route(false, false).first == Action::Skip) {
+                return true;
+            } // if nothing reads value
+            return Deliver(std::move(value));
+        }
+
+        bool OpenContainer(nlohmann::json container) {
+            if(fragment.IsBuilding()) {
+                fragment.Open(std::move(container));
+                return true;
+            } // if building a fragment
+            if(skipDepth > 0) {
+                ++skipDepth;
+                return true;
+            } // if skipping
+            const auto& [action, context]{Route(container.is_object(), true)};
+            if(action == Action::Skip) {
+                skipDepth = 1;
+            } // if nothing reads container
+            else if(action == Action::Build) {
+                fragment.Open(std::move(container));
+            } // else if container is built
+            else {
+                return Enter(context);
+            } // else container is walked
+            return true;
+        }
+
+        bool CloseContainer() {
+            if(fragment.IsBuilding()) {
+                fragment.Close();
+                return fragment.IsComplete() ? Deliver(fragment.Take()) : true;
+            } // if building a fragment
+            if(skipDepth > 0) {
+                --skipDepth;
+                return true;
+            } // if skipping
+            return Leave();
+        }
+
+        bool Fail(Error failure) {
+            error = std::move(failure);
+            return false;
+        }
+
+        bool Enter(Context context) {
+            // Lists are named after the key they were found under
+            const std::string key{
+                context == Context::SceneList || context == Context::LayerList || context == Context::MenuList
+                    ? frames.back().key
+                    : std::string{}
+            };
+            if(context == Context::Layout) {
+                foundLayout = true;
+            } // if Layout
+            else if(context == Context::Layer) {
+                layer.emplace();
+            } // else if Layer
+            else if(context == Context::Menu) {
+                menus.emplace_back();
+                menus.back().parentID = menus.size() > 1 ? EntityID{} : properties.id;
+            } // else if Menu
+            else if(context == Context::MenuList) {
+                MenuState& menu{menus.back()};
+                menu.foundButtons |= key == "buttons";
+                menu.foundRadioButtons |= key == "radioButtons";
+            } // else if a list of widgets in a Menu
+            frames.push_back(Frame{context, key});
+            return true;
+        }
+
+        bool Leave() {
+            const Context context{frames.back().context};
+            frames.pop_back();
+            switch(context) {
+                case Context::Scene: {
+                    return LeaveScene();
+                }
+                case Context::Layer: {
+                    return LeaveLayer();
+                }
+                case Context::Menu: {
+                    return LeaveMenu();
+                }
+                default: {
+                    return true;
+                }
+            } // switch context
+        }
+
+        // A whole value, built or scalar, for the current Frame
+        bool Deliver(const nlohmann::json& value) {
+            const Frame& frame{frames.back()};
+            switch(frame.context) {
+                case Context::Document: {
+                    // Not an object; LoadScene reports why
+                    const auto& loadSceneResult{farcical::ui::LoadScene(value)};
+                    if(!loadSceneResult.has_value()) {
+                        return Fail(loadSceneResult.error());
+                    } // if loadSceneResult == failure
+                    properties = loadSceneResult.value();
+                    isComplete = true;
+                    return true;
+                }
+                case Context::Scene: {
+                    return DeliverToScene(frame.key, value);
+                }
+                case Context::SceneList: {
+                    return DeliverSceneListElement(frame.key, value);
+                }
+                case Context::Layout: {
+                    const auto& loadLayerResult{farcical::ui::LoadLayoutLayer(value, properties.id)};
+                    if(!loadLayerResult.has_value()) {
+                        return Fail(loadLayerResult.error());
+                    } // if loadLayerResult == failure
+                    const LayoutLayerProperties& layerProperties{loadLayerResult.value()};
+                    properties.layout.layers[static_cast<int>(layerProperties.id)] = layerProperties;
+                    return true;
+                }
+                case Context::Layer: {
+                    return DeliverToLayer(frame.key, value);
+                }
+                case Context::LayerList: {
+                    return DeliverLayerListElement(frame.key, value);
+                }
+                case Context::Menu: {
+                    if(IsMenuHeaderKey(frame.key)) {
+                        menus.back().header[frame.key] = value;
+                        return true;
+                    } // if part of the header
+                    // A list that isn't one; loop over it the way LoadMenu would
+                    MenuState& menu{menus.back()};
+                    menu.foundButtons |= frame.key == "buttons";
+                    menu.foundRadioButtons |= frame.key == "radioButtons";
+                    for(const auto& element: value) {
+                        DeliverMenuListElement(frame.key, element);
+                    } // for each element
+                    return true;
+                }
+                case Context::MenuList: {
+                    DeliverMenuListElement(frame.key, value);
+                    return true;
+                }
+            } // switch context
+            return true;
+        }
+
+        bool DeliverToScene(std::string_view key, const nlohmann::json& value) {
+            if(key == "id") {
+                properties.id = EntityID{value.get<std::string>()};
+                foundID = true;
+            } // if ID
+            else if(key == "music") {
+                const auto& loadMusicResult{farcical::LoadMusicProperties(value)};
+                if(!loadMusicResult.has_value()) {
+                    return Fail(loadMusicResult.error());
+                } // if loadMusicResult == failure
+                properties.music = loadMusicResult.value();
+            } // else if Music
+            else if(key == "borderTexture") {
+                const auto& loadTextureResult{farcical::LoadBorderTextureProperties(value)};
+                if(!loadTextureResult.has_value()) {
+                    return Fail(loadTextureResult.error());
+                } // if loadTextureResult == failure
+                properties.borderTexture = loadTextureResult.value();
+            } // else if borderTexture
+            else if(key == "layout") {
+                foundLayout = true;
+                const auto& loadLayoutResult{farcical::ui::LoadLayout(value, properties.id)};
+                if(!loadLayoutResult.has_value()) {
+                    return Fail(loadLayoutResult.error());
+                } // if loadLayoutResult == failure
+                properties.layout = loadLayoutResult.value();
+            } // else if Layout
+            else {
+                for(const auto& element: value) {
+                    if(!DeliverSceneListElement(key, element)) {
+                        return false;
+                    } // if element == failure
+                } // for each element
+            } // else a list of resources
+            return true;
+        }
+
+        bool DeliverSceneListElement(std::string_view key, const nlohmann::json& value) {
+            if(key == "fonts") {
+                const auto& loadFontResult{farcical::LoadFontProperties(value)};
+                if(!loadFontResult.has_value()) {
+                    return Fail(loadFontResult.error());
+                } // if loadFontResult == failure
+                properties.fonts.push_back(loadFontResult.value());
+            } // if Fonts
+            else if(key == "textures") {
+                const auto& loadTextureResult{farcical::LoadTextureProperties(value)};
+                if(!loadTextureResult.has_value()) {
+                    return Fail(loadTextureResult.error());
+                } // if loadTextureResult == failure
+                properties.textures.push_back(loadTextureResult.value());
+            } // else if Textures
+            else if(key == "repeatingTextures") {
+                const auto& loadTextureResult{farcical::LoadRepeatingTextureProperties(value)};
+                if(!loadTextureResult.has_value()) {
+                    return Fail(loadTextureResult.error());
+                } // if loadTextureResult == failure
+                properties.repeatingTextures.push_back(loadTextureResult.value());
+            } // else if repeatingTextures
+            else if(key == "segmentedTextures") {
+                const auto& loadTextureResult{farcical::LoadSegmentedTextureProperties(value)};
+                if(!loadTextureResult.has_value()) {
+                    return Fail(loadTextureResult.error());
+                } // if loadTextureResult == failure
+                properties.segmentedTextures.push_back(loadTextureResult.value());
+            } // else if segmentedTextures
+            else if(key == "overlayTextures") {
+                const auto& loadTextureResult{farcical::LoadOverlayTextureProperties(value)};
+                if(!loadTextureResult.has_value()) {
+                    return Fail(loadTextureResult.error());
+                } // if loadTextureResult == failure
+                properties.overlayTextures.push_back(loadTextureResult.value());
+            } // else if overlayTextures
+            return true;
+        }
+
+        bool DeliverToLayer(std::string_view key, const nlohmann::json& value) {
+            LayoutLayerProperties& layerProperties{layer->properties};
+            if(key == "id") {
+                layerProperties.id = farcical::ui::Layout::Layer::GetLayerIDByName(value.get<std::string>());
+                layer->foundID = true;
+            } // if layerID
+            else if(key == "title") {
+                const auto& loadTitleResult{farcical::ui::LoadTextProperties(value, properties.id)};
+                if(!loadTitleResult.has_value()) {
+                    return Fail(loadTitleResult.error());
+                } // if loadTitleResult == failure
+                layerProperties.titleProperties = loadTitleResult.value();
+            } // else if Title
+            else if(key == "menu") {
+                // Not an object; LoadMenu reports why
+                const auto& loadMenuResult{farcical::ui::LoadMenu(value, properties.id)};
+                if(!loadMenuResult.has_value()) {
+                    return Fail(loadMenuResult.error());
+                } // if loadMenuResult == failure
+                layerProperties.menuProperties = loadMenuResult.value();
+            } // else if Menu
+            else {
+                for(const auto& element: value) {
+                    if(!DeliverLayerListElement(key, element)) {
+                        return false;
+                    } // if element == failure
+                } // for each element
+            } // else a list of widgets
+            return true;
+        }
+
+        bool DeliverLayerListElement(std::string_view key, const nlohmann::json& value) {
+            LayoutLayerProperties& layerProperties{layer->properties};
+            if(key == "decorations") {
+                const auto& loadDecorationResult{farcical::ui::LoadDecoration(value, properties.id)};
+                if(!loadDecorationResult.has_value()) {
+                    return Fail(loadDecorationResult.error());
+                } // if loadDecorationResult == failure
+                layerProperties.decorationProperties.push_back(loadDecorationResult.value());
+            } // if Decorations
+            else if(key == "headings") {
+                const auto& loadHeadingResult{farcical::ui::LoadTextProperties(value, properties.id)};
+                if(!loadHeadingResult.has_value()) {
+                    return Fail(loadHeadingResult.error());
+                } // if loadHeadingResult == failure
+                layerProperties.headingProperties.push_back(loadHeadingResult.value());
+            } // else if Headings
+            return true;
+        }
+
+        // Errors are only held on to here, since the list may turn out not to matter for this Menu's type. The Menu's
+        // ID may not have come yet, so LeaveMenu fills in every parentID.
+        void DeliverMenuListElement(std::string_view key, const nlohmann::json& value) {
+            MenuState& menu{menus.back()};
+            const EntityID menuID;
+            if(key == "buttons") {
+                const auto& loadButtonResult{farcical::ui::LoadButton(value, menuID)};
+                if(!loadButtonResult.has_value() && !menu.buttonsError.has_value()) {
+                    menu.buttonsError = loadButtonResult.error();
+                } // if loadButtonResult == failure
+                else if(loadButtonResult.has_value()) {
+                    menu.buttons.push_back(loadButtonResult.value());
+                } // else if loadButtonResult == success
+            } // if Buttons
+            else if(key == "radioButtons") {
+                const auto& loadRadioButtonResult{farcical::ui::LoadRadioButton(value, menuID)};
+                if(!loadRadioButtonResult.has_value() && !menu.radioButtonsError.has_value()) {
+                    menu.radioButtonsError = loadRadioButtonResult.error();
+                } // if loadRadioButtonResult == failure
+                else if(loadRadioButtonResult.has_value()) {
+                    menu.radioButtons.push_back(loadRadioButtonResult.value());
+                } // else if loadRadioButtonResult == success
+            } // else if RadioButtons
+            else if(key == "menus") {
+                // Not an object; LoadMenu reports why
+                DeliverSubMenu(farcical::ui::LoadMenu(value, menuID));
+            } // else if subMenus
+        }
+
+        bool LeaveScene() {
+            if(!foundID) {
+                const std::string failMsg{"Invalid configuration: No ID found for Scene."};
+                return Fail(Error{Error::Signal::InvalidConfiguration, failMsg});
+            } // if ID not found
+            if(!foundLayout) {
+                const std::string failMsg{
+                    "Invalid configuration: Layout not found for Scene with id=" + properties.id + "."
+                };
+                return Fail(Error{Error::Signal::InvalidConfiguration, failMsg});
+            } // if Layout not found
+            // The ID may have come after the widgets that belong to it
+            for(auto& layerProperties: properties.layout.layers) {
+                for(auto& decorationProperties: layerProperties.decorationProperties) {
+                    decorationProperties.parentID = properties.id;
+                } // for each Decoration
+                if(!layerProperties.titleProperties.id.empty()) {
+                    layerProperties.titleProperties.parentID = properties.id;
+                } // if Title
+                for(auto& headingProperties: layerProperties.headingProperties) {
+                    headingProperties.parentID = properties.id;
+                } // for each Heading
+                if(!layerProperties.menuProperties.id.empty()) {
+                    layerProperties.menuProperties.parentID = properties.id;
+                } // if Menu
+            } // for each layer
+            isComplete = true;
+            return true;
+        }
+
+        bool LeaveLayer() {
+            LayoutLayerProperties& layerProperties{layer->properties};
+            if(!layer->foundID) {
+                const std::string failMsg{
+                    "Invalid configuration: layerID not found in Layout for Menu with id=\"" + properties.id + "\"."
+                };
+                return Fail(Error{Error::Signal::InvalidConfiguration, failMsg});
+            } // if layerID not found
+            for(auto& decorationProperties: layerProperties.decorationProperties) {
+                decorationProperties.layerID = layerProperties.id;
+            } // for each Decoration
+            if(!layerProperties.titleProperties.id.empty()) {
+                layerProperties.titleProperties.layerID = layerProperties.id;
+            } // if Title
+            for(auto& headingProperties: layerProperties.headingProperties) {
+                headingProperties.layerID = layerProperties.id;
+            } // for each Heading
+            if(!layerProperties.menuProperties.id.empty()) {
+                layerProperties.menuProperties.layerID = layerProperties.id;
+            } // if Menu
+            properties.layout.layers[static_cast<int>(layerProperties.id)] = std::move(layerProperties);
+            layer.reset();
+            return true;
+        }
+
+        bool LeaveMenu() {
+            MenuState menu{std::move(menus.back())};
+            menus.pop_back();
+            const auto& loadMenuResult{FinishMenu(std::move(menu))};
+            if(frames.back().context == Context::Layer) {
+                if(!loadMenuResult.has_value()) {
+                    return Fail(loadMenuResult.error());
+                } // if loadMenuResult == failure
+                layer->properties.menuProperties = loadMenuResult.value();
+            } // if this is the layer's Menu
+            else {
+                DeliverSubMenu(loadMenuResult);
+            } // else this is a subMenu
+            return true;
+        }
+
+        // The same as DeliverMenuListElement, for a subMenu that was walked rather than built
+        void DeliverSubMenu(const std::expected<MenuProperties, Error>& loadSubMenuResult) {
+            MenuState& menu{menus.back()};
+            if(!loadSubMenuResult.has_value() && !menu.menusError.has_value()) {
+                menu.menusError = loadSubMenuResult.error();
+            } // if loadSubMenuResult == failure
+            else if(loadSubMenuResult.has_value()) {
+                menu.menus.push_back(loadSubMenuResult.value());
+            } // else if loadSubMenuResult == success
+        }
+
+        // Check & assemble a walked Menu the way LoadMenu would
+        static std::expected<MenuProperties, Error> FinishMenu(MenuState menu) {
+            const auto& loadHeaderResult{farcical::ui::LoadMenuHeader(menu.header, menu.parentID)};
+            if(!loadHeaderResult.has_value()) {
+                return std::unexpected(loadHeaderResult.error());
+            } // if loadHeaderResult == failure
+            MenuProperties menuProperties{loadHeaderResult.value()};
+            if(menuProperties.menuType == Menu::Type::Button) {
+                if(!menu.foundButtons) {
+                    const std::string failMsg{
+                        "Invalid configuration: Buttons could not be found for Menu with id=\"" + menuProperties.id +
+                        "\"."
+                    };
+                    return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+                } // if buttons not found
+                if(menu.buttonsError.has_value()) {
+                    return std::unexpected(menu.buttonsError.value());
+                } // if a Button failed to load
+                for(auto& buttonProperties: menu.buttons) {
+                    buttonProperties.parentID = menuProperties.id;
+                    buttonProperties.relativePosition = menuProperties.relativePosition;
+                } // for each Button
+                menuProperties.buttonProperties = std::move(menu.buttons);
+            } // if menuType == Button
+            else if(menuProperties.menuType == Menu::Type::RadioButton) {
+                if(!menu.foundRadioButtons) {
+                    const std::string failMsg{
+                        "Invalid configuration: RadioButtons could not be found for Menu with id=\"" +
+                        menuProperties.id + "\"."
+                    };
+                    return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+                } // if radioButtons not found
+                if(menu.radioButtonsError.has_value()) {
+                    return std::unexpected(menu.radioButtonsError.value());
+                } // if a RadioButton failed to load
+                for(auto& radioButtonProperties: menu.radioButtons) {
+                    radioButtonProperties.parentID = menuProperties.id;
+                    radioButtonProperties.relativePosition = menuProperties.relativePosition;
+                } // for each RadioButton
+                menuProperties.radioButtonProperties = std::move(menu.radioButtons);
+            } // else if menuType == RadioButton
+            else if(menuProperties.menuType == Menu::Type::SubMenu) {
+                if(menu.menusError.has_value()) {
+                    return std::unexpected(menu.menusError.value());
+                } // if a subMenu failed to load
+                for(auto& subMenuProperties: menu.menus) {
+                    subMenuProperties.parentID = menuProperties.id;
+                } // for each subMenu
+                menuProperties.menuProperties = std::move(menu.menus);
+            } // else if menuType == SubMenu
+            return menuProperties;
+        }
+
+        SceneProperties properties;
+        std::vector<Frame> frames{Frame{Context::Document, ""}};
+        std::optional<LayerState> layer;
+        std::vector<MenuState> menus;
+        FragmentBuilder fragment;
+        std::size_t skipDepth{0};
+        bool foundID{false};
+        bool foundLayout{false};
+        bool isComplete{false};
+        std::optional<Error> error;
+    };
+}
+
+std::expected<farcical::ui::SceneProperties, farcical::engine::Error> farcical::ui::ReadScene(
+    std::string_view document) {
+    FARCICAL_PROFILE_SCOPE("ui::ReadScene");
+    SceneReader reader;
+    nlohmann::json::sax_parse(document.begin(), document.end(), &reader);
+    return reader.TakeResult();
+}
+
+std::expected<farcical::ui::SceneProperties, farcical::engine::Error> farcical::ui::ReadSceneFile(
+    std::string_view path) {
+    engine::MappedFile input;
+    const auto& mapFile{input.Open(path, engine::MappedFile::Mode::ReadOnly)};
+    if(mapFile.has_value()) {
+        return std::unexpected(mapFile.value());
+    } // if mapFile == failure
+    return ReadScene(std::string_view{reinterpret_cast<const char*>(input.GetData()), input.GetSize()});
+}
@@ -7,44 +7,68 @@
 #include "../../include/engine/system/render.hpp"
 #include "../../include/color.hpp"
 
-farcical::ui::Text::Text(engine::EntityID id, Container* parent) : Widget(id, Widget::Type::Text, parent, false),
-                                                                   font{nullptr},
-                                                                   contents{""} {
+farcical::ui::Text::Text(engine::EntityID id, engine::RenderSystem& renderSystem, Container* parent):
+    Widget(id, Widget::Type::Text, parent, false),
+    renderSystem{renderSystem},
+    font{nullptr},
+    contents{""} {
 }
 
 void farcical::ui::Text::SetFont(sf::Font& font) {
     this->font = &font;
+    engine::RenderComponent* renderCmp{GetRenderComponent()};
+    if(renderCmp) {
+        renderCmp->SetFont(this->font);
+    } // if renderCmp
 }
 
 void farcical::ui::Text::SetFontSize(unsigned int fontSize) {
     fontProperties.characterSize = fontSize;
+    SetFontProperties(fontProperties);
 }
 
 void farcical::ui::Text::SetFontColor(sf::Color color) {
     fontProperties.color = color;
+    SetFontProperties(fontProperties);
 }
 
 void farcical::ui::Text::SetOutlineColor(sf::Color color) {
     fontProperties.outlineColor = color;
+    SetFontProperties(fontProperties);
 }
 
 void farcical::ui::Text::SetOutlineThickness(float thickness) {
     fontProperties.outlineThickness = thickness;
+    SetFontProperties(fontProperties);
 }
 
 void farcical::ui::Text::SetContents(std::string_view contents) {
     this->contents = contents;
-    if(font) {
+    engine::RenderComponent* renderCmp{GetRenderComponent()};
+    if(renderCmp && renderCmp->font) {
+        // Measure with the retained sf::Text that will be drawn, rather than laying the glyphs out twice
+        renderCmp->SetContents(this->contents);
+        const sf::FloatRect bounds{renderCmp->GetText()->getLocalBounds()};
+        this->size = sf::Vector2u{
+            static_cast<unsigned int>(bounds.size.x),
+            static_cast<unsigned int>(bounds.size.y)
+        };
+    } // if renderCmp
+    else if(font) {
         sf::Text text{*font, this->contents, fontProperties.characterSize};
         this->size = sf::Vector2u{
             static_cast<unsigned int>(text.getLocalBounds().size.x),
             static_cast<unsigned int>(text.getLocalBounds().size.y)
         };
-    } // if font
+    } // else if font
 }
 
 void farcical::ui::Text::SetFontProperties(const FontProperties& properties) {
     this->fontProperties = properties;
+    engine::RenderComponent* renderCmp{GetRenderComponent()};
+    if(renderCmp) {
+        renderCmp->SetFontProperties(this->fontProperties);
+    } // if renderCmp
 }
 
 std::string_view farcical::ui::Text::GetContents() const {
@@ -59,6 +83,10 @@ const farcical::FontProperties& farcical::ui::Text::GetFontProperties() const {
     return fontProperties;
 }
 
+farcical::engine::RenderComponent* farcical::ui::Text::GetRenderComponent() const {
+    return renderSystem.GetRenderComponent(GetComponent(engine::Component::Type::Render));
+}
+
 void farcical::ui::Text::DoAction(Action action) {
     if(action.type == Action::Type::ReceiveFocus) {
         SetOutlineColor(sf::Color::Black);
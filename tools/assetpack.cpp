@@ -0,0 +1,99 @@
+//
+// Created by dgmuller on 9/15/25.
+//
+// Builds, lists & checks the AssetPack the game mounts at startup (Config::assetPackPath). Files are packed under the
+// paths they're given by, so run it from the directory the game runs from:
+//
+//   assetpack build dat/farcical.pack dat/fonts dat/music dat/scenes dat/textures
+//   assetpack list dat/farcical.pack
+//   assetpack verify dat/farcical.pack
+//
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../include/resource/assetPack.hpp"
+
+namespace {
+    // Directories are packed recursively; the pack itself is never packed into itself
+    std::vector<std::string> CollectFiles(const std::vector<std::string>& inputs, const std::string& outputPath) {
+        std::vector<std::string> files;
+        for(const auto& input: inputs) {
+            if(!std::filesystem::is_directory(input)) {
+                files.push_back(input);
+                continue;
+            } // if input is a single file
+            for(const auto& directoryEntry: std::filesystem::recursive_directory_iterator{input}) {
+                if(directoryEntry.is_regular_file()) {
+                    files.push_back(directoryEntry.path().generic_string());
+                } // if directoryEntry is a file
+            } // for each entry under input
+        } // for each input
+        const std::string packPath{farcical::AssetPack::NormalizePath(outputPath)};
+        std::erase_if(files, [&packPath](const std::string& file) {
+            const std::string path{farcical::AssetPack::NormalizePath(file)};
+            return path == packPath || path == packPath + ".tmp";
+        });
+        return files;
+    }
+
+    int PrintUsage(std::string_view program) {
+        std::cerr << "Usage: " << program << " build <pack> <file or directory>..." << std::endl;
+        std::cerr << "       " << program << " list <pack>" << std::endl;
+        std::cerr << "       " << program << " verify <pack>" << std::endl;
+        return 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::vector<std::string> args{argv + 1, argv + argc};
+    if(args.size() < 2) {
+        return PrintUsage(argv[0]);
+    } // if too few arguments
+    const std::string& command{args[0]};
+    const std::string& packPath{args[1]};
+
+    if(command == "build") {
+        if(args.size() < 3) {
+            return PrintUsage(argv[0]);
+        } // if nothing to pack
+        const std::vector<std::string> files{CollectFiles({args.begin() + 2, args.end()}, packPath)};
+        const auto& buildPack{farcical::AssetPack::Build(packPath, files)};
+        if(buildPack.has_value()) {
+            std::cerr << buildPack.value().message << std::endl;
+            return 1;
+        } // if buildPack == failure
+        std::cout << files.size() << " files packed into " << packPath << std::endl;
+        return 0;
+    } // if command == build
+
+    if(command != "list" && command != "verify") {
+        return PrintUsage(argv[0]);
+    } // if command is unknown
+    farcical::AssetPack assetPack;
+    const auto& openPack{assetPack.Open(packPath)};
+    if(openPack.has_value()) {
+        std::cerr << openPack.value().message << std::endl;
+        return 1;
+    } // if openPack == failure
+    int numCorrupt{0};
+    for(const auto& path: assetPack.GetPaths()) {
+        if(command == "list") {
+            std::cout << assetPack.Find(path)->size() << "\t" << path << std::endl;
+            continue;
+        } // if command == list
+        const auto& verifyEntry{assetPack.Verify(path)};
+        if(verifyEntry.has_value()) {
+            std::cerr << verifyEntry.value().message << std::endl;
+            ++numCorrupt;
+        } // if verifyEntry == failure
+    } // for each packed path
+    if(command == "verify") {
+        std::cout << assetPack.GetNumEntries() - numCorrupt << " of " << assetPack.GetNumEntries() << " entries intact"
+                  << std::endl;
+    } // if command == verify
+    return numCorrupt == 0 ? 0 : 1;
+}
@@ -0,0 +1,348 @@
+//
+// Created by dgmuller on 9/16/25.
+//
+// Prepares everything in the SceneIndex ahead of time, so creating a Scene only has to load files. Run it from the
+// directory the game runs from, and again after editing any texture (until then, composites drawn from an edited
+// texture are drawn at runtime again, since their cooked copies are named for their inputs' old contents):
+//
+//   farcical_cook dat/farcical.json dat/cooked
+//
+// then set cookedAssetPath to dat/cooked (and sceneCachePath to dat/cooked/scenes) in the engine config. Writes:
+//
+//   textures/<id>-<hash>.png      every Repeating, Segmented, Overlay & Border texture, already composited
+//   scenes/                       a SceneCache entry (binary SceneProperties) for each scene document
+//   manifests/<sceneID>.json      every file each Scene depends on, with its content hash
+//
+// Borders are drawn to fit the window described by the engine config (or the desktop, with detectNativeResolution).
+//
+
+#include <any>
+#include <cctype>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Window/VideoMode.hpp>
+#include "../include/engine/config.hpp"
+#include "../include/engine/hash.hpp"
+#include "../include/resource/manager.hpp"
+#include "../include/ui/cookedAssets.hpp"
+#include "../include/ui/sceneCache.hpp"
+#include "../include/ui/sceneReader.hpp"
+
+namespace {
+    using farcical::engine::Error;
+
+    // LoadConfig reports through an ErrorGenerator; without a running Engine, its arguments just become the message
+    class CookErrorGenerator final : public farcical::engine::ErrorGenerator {
+    public:
+        Error GenerateError(Error::Signal signal, std::vector<std::any> args) override {
+            std::string message;
+            for(const auto& arg: args) {
+                if(const auto* text{std::any_cast<std::string>(&arg)}) {
+                    message += *text + " ";
+                } // if arg is text
+            } // for each arg
+            return Error{signal, message, ""};
+        }
+    };
+
+    std::expected<nlohmann::json, Error> ReadJSON(const std::string& path) {
+        std::ifstream input{path};
+        if(!input.is_open()) {
+            const std::string failMsg{"Invalid path: Could not open " + path + "."};
+            return std::unexpected(Error{Error::Signal::InvalidPath, failMsg});
+        } // if file could not be opened
+        nlohmann::json json = nlohmann::json::parse(input, nullptr, false);
+        if(json.is_discarded()) {
+            const std::string failMsg{"Invalid configuration: Could not parse " + path + "."};
+            return std::unexpected(Error{Error::Signal::InvalidConfiguration, failMsg});
+        } // if parse failed
+        return json;
+    }
+
+    // A manifest entry: the file's path and a hash of its contents, or null if it can't be read
+    nlohmann::json DescribeFile(const std::string& path) {
+        nlohmann::json description = {{"path", path}, {"hash", nullptr}};
+        std::ifstream input{path, std::ios_base::in | std::ios_base::binary};
+        if(input.is_open()) {
+            const std::string contents{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+            description["hash"] = std::format("{:016x}", farcical::engine::HashBytes(contents));
+        } // if file could be read
+        return description;
+    }
+
+    // Draws one Scene's composites with its own ResourceManager, the same way SceneManager's Build*Cache functions do
+    class SceneCook {
+    public:
+        SceneCook(const farcical::ui::CookedAssets& cookedAssets,
+                  const sf::Vector2u& windowSize,
+                  const farcical::ui::SceneProperties& properties) : cookedAssets{cookedAssets},
+                                                                     windowSize{windowSize},
+                                                                     properties{properties},
+                                                                     composites{nlohmann::json::array()} {
+        }
+
+        std::optional<Error> Cook() {
+            for(const auto& textureProperties: properties.textures) {
+                const auto& loadTexture{LoadTexture(textureProperties)};
+                if(loadTexture.has_value()) {
+                    return loadTexture;
+                } // if loadTexture == failure
+            } // for each Texture
+
+            for(const auto& textureProperties: properties.repeatingTextures) {
+                for(const auto& id: {textureProperties.inputID, textureProperties.outputID}) {
+                    const auto& createHandle{
+                        resourceManager.CreateResourceHandle(id, farcical::ResourceHandle::Type::Texture,
+                                                             textureProperties.path)
+                    };
+                    if(!createHandle.has_value()) {
+                        return createHandle.error();
+                    } // if createHandle == failure
+                } // for input & output
+                const auto& createTexture{resourceManager.GetTexture(textureProperties)};
+                const auto& saveTexture{
+                    SaveComposite(createTexture, textureProperties.outputID,
+                                  cookedAssets.GetTexturePath(resourceManager, textureProperties),
+                                  {textureProperties.path})
+                };
+                if(saveTexture.has_value()) {
+                    return saveTexture;
+                } // if saveTexture == failure
+            } // for each RepeatingTexture
+
+            for(const auto& textureProperties: properties.segmentedTextures) {
+                const farcical::ResourceID splicedTextureID{textureProperties.id + "Texture"};
+                std::vector<farcical::ResourceID> segmentIDList;
+                std::vector<std::string> inputPaths;
+                for(auto segmentProperties: textureProperties.segments) {
+                    farcical::ResourceID segmentID{textureProperties.id};
+                    segmentID += static_cast<char>(std::toupper(segmentProperties.id[0]));
+                    segmentID.append(segmentProperties.id.substr(1));
+                    segmentID.append("Texture");
+                    segmentProperties.id = segmentID;
+                    const auto& loadSegment{LoadTexture(segmentProperties)};
+                    if(loadSegment.has_value()) {
+                        return loadSegment;
+                    } // if loadSegment == failure
+                    segmentIDList.push_back(segmentID);
+                    inputPaths.push_back(segmentProperties.path);
+                } // for each segment of SegmentedTexture
+                const auto& createTexture{resourceManager.CreateSplicedTexture(splicedTextureID, segmentIDList)};
+                const auto& saveTexture{
+                    SaveComposite(createTexture, splicedTextureID,
+                                  cookedAssets.GetTexturePath(resourceManager, textureProperties), inputPaths)
+                };
+                if(saveTexture.has_value()) {
+                    return saveTexture;
+                } // if saveTexture == failure
+            } // for each SegmentedTexture
+
+            for(const auto& textureProperties: properties.overlayTextures) {
+                const auto& createTexture{
+                    resourceManager.CreateOverlayTexture(textureProperties.id,
+                                                         textureProperties.baseTextureID,
+                                                         textureProperties.overlayTextureID,
+                                                         textureProperties.opacity)
+                };
+                const auto& saveTexture{
+                    SaveComposite(createTexture, textureProperties.id + "Texture",
+                                  cookedAssets.GetTexturePath(resourceManager, textureProperties, properties),
+                                  cookedAssets.GetInputPaths(textureProperties, properties))
+                };
+                if(saveTexture.has_value()) {
+                    return saveTexture;
+                } // if saveTexture == failure
+            } // for each OverlayTexture
+
+            const farcical::BorderTextureProperties& border{properties.borderTexture};
+            // A NineSlice Border is drawn from its slices at runtime, so there is nothing to bake for it
+            if(!border.id.empty() && !border.isNineSlice) {
+                std::vector<farcical::ResourceID> cornerTextureIDs;
+                std::vector<farcical::ResourceID> edgeTextureIDs;
+                std::vector<std::string> inputPaths;
+                for(const auto& corner: border.cornerTextures) {
+                    const auto& loadCorner{LoadTexture(corner)};
+                    if(loadCorner.has_value()) {
+                        return loadCorner;
+                    } // if loadCorner == failure
+                    cornerTextureIDs.push_back(corner.id);
+                    inputPaths.push_back(corner.path);
+                } // for each corner
+                for(const auto& edge: border.edgeTextures) {
+                    const auto& loadEdge{LoadTexture(edge)};
+                    if(loadEdge.has_value()) {
+                        return loadEdge;
+                    } // if loadEdge == failure
+                    edgeTextureIDs.push_back(edge.id);
+                    inputPaths.push_back(edge.path);
+                } // for each edge
+                const auto& loadCenter{LoadTexture(border.centerTexture)};
+                if(loadCenter.has_value()) {
+                    return loadCenter;
+                } // if loadCenter == failure
+                inputPaths.push_back(border.centerTexture.path);
+                const sf::Vector2u outputSize{farcical::ui::GetBorderTextureSize(border, windowSize)};
+                const auto& createTexture{
+                    resourceManager.CreateBorderTexture(border.id, outputSize, cornerTextureIDs, edgeTextureIDs,
+                                                        border.centerTexture.id)
+                };
+                const auto& saveTexture{
+                    SaveComposite(createTexture, border.id,
+                                  cookedAssets.GetTexturePath(resourceManager, border, outputSize), inputPaths)
+                };
+                if(saveTexture.has_value()) {
+                    return saveTexture;
+                } // if saveTexture == failure
+            } // if Scene has a BorderTexture
+            return std::nullopt;
+        }
+
+        // Everything the Scene loads, and every composite drawn for it
+        nlohmann::json GetManifest(const std::string& documentPath) const {
+            nlohmann::json fonts = nlohmann::json::array();
+            for(const auto& fontProperties: properties.fonts) {
+                fonts.push_back(DescribeFile(fontProperties.path));
+            } // for each Font
+            nlohmann::json textures = nlohmann::json::array();
+            for(const auto& textureProperties: properties.textures) {
+                textures.push_back(DescribeFile(textureProperties.path));
+            } // for each Texture
+            nlohmann::json manifest = {
+                {"id", properties.id.GetName()},
+                {"document", DescribeFile(documentPath)},
+                {"fonts", fonts},
+                {"textures", textures},
+                {"composites", composites}
+            };
+            if(!properties.music.path.empty()) {
+                manifest["music"] = DescribeFile(properties.music.path);
+            } // if Scene has music
+            return manifest;
+        }
+
+    private:
+        std::optional<Error> LoadTexture(const farcical::TextureProperties& textureProperties) {
+            if(!resourceManager.GetResourceHandle(textureProperties.id)) {
+                const auto& createHandle{
+                    resourceManager.CreateResourceHandle(textureProperties.id, farcical::ResourceHandle::Type::Texture,
+                                                         textureProperties.path)
+                };
+                if(!createHandle.has_value()) {
+                    return createHandle.error();
+                } // if createHandle == failure
+            } // if handle does not exist
+            const auto& loadTexture{resourceManager.GetTexture(textureProperties)};
+            if(!loadTexture.has_value()) {
+                return loadTexture.error();
+            } // if loadTexture == failure
+            return std::nullopt;
+        }
+
+        std::optional<Error> SaveComposite(const std::expected<sf::Texture*, Error>& createTexture,
+                                           const farcical::ResourceID& id,
+                                           const std::string& cookedPath,
+                                           const std::vector<std::string>& inputPaths) {
+            if(!createTexture.has_value()) {
+                return createTexture.error();
+            } // if createTexture == failure
+            std::error_code errorCode;
+            std::filesystem::create_directories(std::filesystem::path{cookedPath}.parent_path(), errorCode);
+            if(!createTexture.value()->copyToImage().saveToFile(cookedPath)) {
+                const std::string failMsg{"Could not write cooked Texture " + cookedPath + "."};
+                return Error{Error::Signal::WriteFailure, failMsg};
+            } // if image could not be written
+            nlohmann::json inputs = nlohmann::json::array();
+            for(const auto& inputPath: inputPaths) {
+                inputs.push_back(DescribeFile(inputPath));
+            } // for each input
+            composites.push_back({{"id", id}, {"path", cookedPath}, {"inputs", inputs}});
+            return std::nullopt;
+        }
+
+        const farcical::ui::CookedAssets& cookedAssets;
+        sf::Vector2u windowSize;
+        const farcical::ui::SceneProperties& properties;
+        farcical::ResourceManager resourceManager;
+        nlohmann::json composites;
+    };
+}
+
+int main(int argc, char** argv) {
+    if(argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <engine config> <output directory>" << std::endl;
+        return 1;
+    } // if wrong number of arguments
+    const std::string configPath{argv[1]};
+    const farcical::ui::CookedAssets cookedAssets{argv[2]};
+
+    const auto& readConfig{ReadJSON(configPath)};
+    if(!readConfig.has_value()) {
+        std::cerr << readConfig.error().message << std::endl;
+        return 1;
+    } // if readConfig == failure
+    CookErrorGenerator errorGenerator;
+    const auto& loadConfig{farcical::engine::LoadConfig(readConfig.value(), configPath, &errorGenerator)};
+    if(!loadConfig.has_value()) {
+        std::cerr << loadConfig.error().message << std::endl;
+        return 1;
+    } // if loadConfig == failure
+    const farcical::engine::Config& config{loadConfig.value()};
+    const sf::Vector2u windowSize{
+        config.windowProperties.detectNativeResolution
+            ? sf::VideoMode::getDesktopMode().size
+            : config.windowProperties.displayMode
+    };
+
+    const auto& readIndex{ReadJSON(config.scenePath + "/index.json")};
+    if(!readIndex.has_value()) {
+        std::cerr << readIndex.error().message << std::endl;
+        return 1;
+    } // if readIndex == failure
+    const farcical::ui::SceneCache sceneCache{cookedAssets.GetSceneCachePath()};
+    int numScenes{0};
+    for(const auto& sceneJSON: readIndex.value()) {
+        const std::string documentPath{
+            config.scenePath + "/" + sceneJSON.value("resource", nlohmann::json::object()).value("path", "")
+        };
+        const auto& readScene{farcical::ui::ReadSceneFile(documentPath)};
+        if(!readScene.has_value()) {
+            std::cerr << documentPath << ": " << readScene.error().message << std::endl;
+            return 1;
+        } // if readScene == failure
+        const farcical::ui::SceneProperties& properties{readScene.value()};
+
+        // The same path the engine will look the document up by
+        const auto& writeCache{sceneCache.Write(documentPath, properties)};
+        if(writeCache.has_value()) {
+            std::cerr << writeCache.value().message << std::endl;
+            return 1;
+        } // if writeCache == failure
+
+        SceneCook sceneCook{cookedAssets, windowSize, properties};
+        const auto& cookScene{sceneCook.Cook()};
+        if(cookScene.has_value()) {
+            std::cerr << documentPath << ": " << cookScene.value().message << std::endl;
+            return 1;
+        } // if cookScene == failure
+
+        const std::filesystem::path manifestPath{cookedAssets.GetManifestPath(properties.id)};
+        std::error_code errorCode;
+        std::filesystem::create_directories(manifestPath.parent_path(), errorCode);
+        std::ofstream manifest{manifestPath};
+        if(!(manifest << sceneCook.GetManifest(documentPath).dump(4) << std::endl)) {
+            std::cerr << "Could not write " << manifestPath.generic_string() << "." << std::endl;
+            return 1;
+        } // if manifest could not be written
+        std::cout << "Cooked Scene " << properties.id.GetName() << " from " << documentPath << std::endl;
+        ++numScenes;
+    } // for each Scene in SceneIndex
+    std::cout << numScenes << " Scenes cooked into " << argv[2] << std::endl;
+    return 0;
+}
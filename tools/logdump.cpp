@@ -0,0 +1,26 @@
+//
+// Created by dgmuller on 9/10/25.
+//
+// Prints the records held in a flight recorder ring file, oldest first.
+//
+//   logdump <logPath>/flightRecorder.ring
+//
+
+#include <iostream>
+#include <string>
+#include "../include/engine/flightRecorder.hpp"
+
+int main(int argc, char** argv) {
+    if(argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <flight recorder file>" << std::endl;
+        return 1;
+    } // if wrong number of arguments
+    const std::string path{argv[1]};
+    const auto& readRing{farcical::engine::FlightRecorder::ReadRing(path)};
+    if(!readRing.has_value()) {
+        std::cerr << readRing.error().message << std::endl;
+        return 1;
+    } // if readRing == failure
+    std::cout << readRing.value();
+    return 0;
+}